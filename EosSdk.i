@@ -200,16 +200,22 @@ typedef uint64_t uint64_be_t;
 
 %{
 #include "eos/acl.h"
+#include "eos/acl_classifier.h"
 #include "eos/agent.h"
 #include "eos/aresolve.h"
 #include "eos/bfd.h"
+#include "eos/bfd_bulk.h"
 #include "eos/bgp.h"
 #include "eos/bgp_path.h"
 #include "eos/event_loop.h"
 #include "eos/class_map.h"
 #include "eos/decap_group.h"
 #include "eos/directflow.h"
+#include "eos/directflow_bulk.h"
+#include "eos/directflow_classifier.h"
 #include "eos/eapi.h"
+#include "eos/eapi_client.h"
+#include "eos/eapi_json.h"
 #include "eos/eth.h"
 #include "eos/eth_intf.h"
 #include "eos/eth_lag_intf.h"
@@ -217,6 +223,7 @@ typedef uint64_t uint64_be_t;
 #include "eos/exception.h"
 #include "eos/fd.h"
 #include "eos/fib.h"
+#include "eos/fib_snapshot.h"
 #include "eos/hardware_table.h"
 #include "eos/hash_mix.h"
 #include "eos/intf.h"
@@ -225,22 +232,31 @@ typedef uint64_t uint64_be_t;
 #include "eos/ip_route.h"
 #include "eos/iterator.h"
 #include "eos/lldp.h"
+#include "eos/lldp_neighbor_info.h"
+#include "eos/lldp_neighbor_cache.h"
 #include "eos/macsec.h"
 #include "eos/mac_table.h"
+#include "eos/mac_move_detector.h"
+#include "eos/mac_table_cache.h"
 #include "eos/mlag.h"
 #include "eos/mpls.h"
 #include "eos/mpls_route.h"
+#include "eos/mpls_route_bulk.h"
+#include "eos/mpls_route_reconciler.h"
 #include "eos/mpls_vrf_label.h"
+#include "eos/mpls_label_allocator.h"
 #include "eos/neighbor_table.h"
 #include "eos/nexthop_group.h"
 #include "eos/nexthop_group_tunnel.h"
 #include "eos/policy_map.h"
 #include "eos/route_map.h"
+#include "eos/sbfd_rtt_aggregator.h"
 #include "eos/sdk.h"
 #include "eos/subintf.h"
 #include "eos/system.h"
 #include "eos/timer.h"
 #include "eos/tracing.h"
+#include "eos/traffic_policy_counters.h"
 #include "eos/utility.h"
 #include "eos/version.h"
 #include "eos/vrf.h"
@@ -347,19 +363,47 @@ void throw_py_error(error const& err) {
 %template() std::map<uint32_t, eos::route_map_entry_t>;
 %template() std::set<eos::intf_id_t>;
 %template() std::set<eos::ip_addr_mask_t>;
+%template() std::set<eos::ip_prefix_t>;
 %template() std::list<uint16_t>;
 %template() std::list<eos::mpls_label_t>;
 %template() std::map<uint16_t, eos::nexthop_group_mpls_action_t>;
 %template() std::map<uint16_t, eos::nexthop_group_entry_t>;
 %template() std::pair<uint32_t, eos::acl_rule_ip_t>;
 %template() std::pair<uint32_t, eos::acl_rule_eth_t>;
+%template() std::vector<eos::acl_packet_t>;
+%template() std::vector<eos::acl_key_t>;
+%template() std::vector<eos::bfd_session_key_t>;
+%template() std::vector<eos::flow_entry_t>;
+%template() std::vector<eos::flow_packet_t>;
+%template() std::vector<eos::flow_status_change_t>;
+%template() std::vector<eos::mac_entry_t>;
+%template() std::vector<eos::mac_key_t>;
+%template() std::pair<eos::mac_key_t, uint32_t>;
+%template() std::vector<std::pair<eos::mac_key_t, uint32_t> >;
+%template() std::vector<eos::lldp_neighbor_info_t>;
+%template() std::pair<eos::sbfd_echo_session_key_t, eos::sbfd_rtt_summary_t>;
+%template() std::vector<std::pair<eos::sbfd_echo_session_key_t, eos::sbfd_rtt_summary_t> >;
+%template() std::vector<eos::json_view_t>;
+%template() std::vector<eos::json_match_t>;
+%template() std::pair<std::string, eos::json_view_t>;
+%template() std::vector<std::pair<std::string, eos::json_view_t> >;
+%template() std::vector<eos::neighbor_entry_t>;
+%template() std::vector<eos::neighbor_key_t>;
+%template() std::vector<eos::bgp_path_t>;
+%template() std::vector<eos::bgp_path_change_t>;
+%template() std::pair<uint16_t, uint16_t>;
+%template() std::vector<std::pair<uint16_t, uint16_t> >;
 %template() std::unordered_set<uint32_t>;
 %template() std::unordered_set<eos::ip_addr_t>;
 %template() std::unordered_set<std::string>;
 %template() std::map<eos::lldp_tlv_type_t, std::string>;
 %template() std::list<eos::lldp_management_address_t>;
 %template() std::vector<std::string>;
+%template() std::vector<uint32_t>;
 %template() std::vector<eos::mpls_label_t>;
+%template() std::vector<eos::mpls_route_via_t>;
+%template() std::vector<eos::mpls_route_key_t>;
+%template() std::vector<eos::fib_route_key_t>;
 %template() std::set<eos::policy_map_action_t>;
 
 STD_FORWARD_LIST(fib_via_t)
@@ -382,6 +426,12 @@ STD_FORWARD_LIST(mpls_label_t)
 %ignore vpanic;
 %ignore modbit;
 %ignore invalid_mpls_label;
+// A json_view_t does not own its text, and a Python string converted for
+// the call would be freed as soon as the view is made: Python code should
+// parse eAPI output with its json module.
+%ignore eos::json_view_t::json_view_t(std::string const &);
+%ignore eos::json_view_t::json_view_t(std::string &&);
+%ignore eos::json_view_t::json_view_t(char const *, size_t);
 %include "Includes.i"
 
 
@@ -104,16 +104,22 @@ typedef uint64_t uint64_be_t;
 
 %{
 //#include "eos/acl.h"
+#include "eos/acl_classifier.h"
 #include "eos/agent.h"
 #include "eos/aresolve.h"
 #include "eos/bfd.h"
+#include "eos/bfd_bulk.h"
 #include "eos/bgp.h"
 #include "eos/bgp_path.h"
 #include "eos/event_loop.h"
 #include "eos/class_map.h"
 #include "eos/decap_group.h"
 #include "eos/directflow.h"
+#include "eos/directflow_bulk.h"
+#include "eos/directflow_classifier.h"
 #include "eos/eapi.h"
+#include "eos/eapi_client.h"
+#include "eos/eapi_json.h"
 #include "eos/eth.h"
 #include "eos/eth_intf.h"
 #include "eos/eth_lag_intf.h"
@@ -121,6 +127,7 @@ typedef uint64_t uint64_be_t;
 #include "eos/exception.h"
 #include "eos/fd.h"
 #include "eos/fib.h"
+#include "eos/fib_snapshot.h"
 #include "eos/hardware_table.h"
 #include "eos/hash_mix.h"
 #include "eos/intf.h"
@@ -129,22 +136,31 @@ typedef uint64_t uint64_be_t;
 #include "eos/ip_route.h"
 #include "eos/iterator.h"
 #include "eos/lldp.h"
+#include "eos/lldp_neighbor_info.h"
+#include "eos/lldp_neighbor_cache.h"
 #include "eos/macsec.h"
 #include "eos/mac_table.h"
+#include "eos/mac_move_detector.h"
+#include "eos/mac_table_cache.h"
 #include "eos/mlag.h"
 #include "eos/mpls.h"
 #include "eos/mpls_route.h"
+#include "eos/mpls_route_bulk.h"
+#include "eos/mpls_route_reconciler.h"
 #include "eos/mpls_vrf_label.h"
+#include "eos/mpls_label_allocator.h"
 #include "eos/neighbor_table.h"
 #include "eos/nexthop_group.h"
 #include "eos/nexthop_group_tunnel.h"
 #include "eos/policy_map.h"
 #include "eos/route_map.h"
+#include "eos/sbfd_rtt_aggregator.h"
 #include "eos/sdk.h"
 #include "eos/subintf.h"
 #include "eos/system.h"
 #include "eos/timer.h"
 #include "eos/tracing.h"
+#include "eos/traffic_policy_counters.h"
 #include "eos/types/policy_map.h"
 #include "eos/utility.h"
 #include "eos/version.h"
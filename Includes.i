@@ -42,10 +42,12 @@
 %include "eos/bfd.h"
 %include "eos/types/nexthop_group.h"
 %include "eos/acl.h"
+%include "eos/acl_classifier.h"
 %include "eos/types/policy_map.h"
 %include "eos/bgp.h"
 %include "eos/types/route_map.h"
 %include "eos/policy_map.h"
+%include "eos/traffic_policy_counters.h"
 %include "eos/types/class_map.h"
 %include "eos/base_handler.h"
 %include "eos/base_mgr.h"
@@ -59,6 +61,8 @@
 %include "eos/version.h"
 %include "eos/agent.h"
 %include "eos/eapi.h"
+%include "eos/eapi_client.h"
+%include "eos/eapi_json.h"
 %include "eos/inline/event_loop.h"
 %include "eos/inline/exception.h"
 %include "eos/inline/hash_mix.h"
@@ -90,9 +94,12 @@
 %include "eos/subintf.h"
 %include "eos/system.h"
 %include "eos/aresolve.h"
+%include "eos/bfd_bulk.h"
 %include "eos/bgp_path.h"
 %include "eos/decap_group.h"
 %include "eos/directflow.h"
+%include "eos/directflow_bulk.h"
+%include "eos/directflow_classifier.h"
 %include "eos/eth_lag_intf.h"
 %include "eos/inline/eth_intf.h"
 %include "eos/inline/eth_phy_intf.h"
@@ -116,19 +123,30 @@
 %include "eos/inline/types/neighbor_table.h"
 %include "eos/inline/types/nexthop_group_tunnel.h"
 %include "eos/inline/types/structured_filter.h"
+%include "eos/lldp_neighbor_info.h"
 %include "eos/lldp.h"
+%include "eos/lldp_neighbor_cache.h"
 %include "eos/mac_table.h"
+%include "eos/mac_move_detector.h"
+%include "eos/mac_table_cache.h"
 %include "eos/macsec.h"
 %include "eos/mpls_route.h"
+%include "eos/mpls_route_bulk.h"
+%include "eos/mpls_route_reconciler.h"
 %include "eos/mpls_vrf_label.h"
+%include "eos/mpls_label_allocator.h"
 %include "eos/neighbor_table.h"
 %include "eos/nexthop_group_tunnel.h"
+%include "eos/sbfd_rtt_aggregator.h"
 %include "eos/inline/acl.h"
+%include "eos/inline/acl_classifier.h"
 %include "eos/inline/aresolve.h"
 %include "eos/inline/bfd.h"
 %include "eos/inline/bgp.h"
 %include "eos/inline/bgp_path.h"
 %include "eos/inline/directflow.h"
+%include "eos/inline/directflow_bulk.h"
+%include "eos/inline/directflow_classifier.h"
 %include "eos/inline/eth_lag_intf.h"
 %include "eos/inline/lldp.h"
 %include "eos/inline/mac_table.h"
@@ -136,7 +154,9 @@
 %include "eos/inline/mpls_route.h"
 %include "eos/inline/neighbor_table.h"
 %include "eos/inline/nexthop_group_tunnel.h"
+%include "eos/inline/sbfd_rtt_aggregator.h"
 %include "eos/fib.h"
+%include "eos/fib_snapshot.h"
 %include "eos/inline/types/fib.h"
 %include "eos/inline/types/nexthop_group.h"
 %include "eos/inline/types/policy_map.h"
@@ -1,7 +1,13 @@
 // Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
 #include "eos/acl.h"
+#include "eos/acl_classifier.h"
 #include "impl.h"
 
 // TODO: an implementation that provides a mock Sysdb view
@@ -17,12 +23,21 @@ acl_handler::acl_handler(acl_mgr * mgr) :
 
 void
 acl_handler::watch_all_acls(bool all) {
+   if(all) {
+      mgr_->add_handler(this);
+   } else {
+      mgr_->remove_handler(this);
+   }
 }
 
 void
 acl_handler::on_acl_sync() {
 }
 
+void
+acl_handler::on_acl_commit(acl_key_t const & key, uint32_t rules_changed) {
+}
+
 void
 acl_handler::on_acl_sync_fail(std::string const & linecard,
                               std::string const & message) {
@@ -30,6 +45,69 @@ acl_handler::on_acl_sync_fail(std::string const & linecard,
 
 // acl_mgr methods
 
+/// Orders ACL keys by name, then type: acl_key_t itself only compares names.
+struct acl_key_less {
+   bool operator()(acl_key_t const & lhs, acl_key_t const & rhs) const {
+      if(lhs.acl_name() != rhs.acl_name()) {
+         return lhs.acl_name() < rhs.acl_name();
+      }
+      return lhs.acl_type() < rhs.acl_type();
+   }
+};
+
+/// Orders the (ACL key, interface) pairs ACLs are applied on.
+struct acl_applied_less {
+   bool operator()(std::pair<acl_key_t, intf_id_t> const & lhs,
+                   std::pair<acl_key_t, intf_id_t> const & rhs) const {
+      acl_key_less key_less;
+      if(key_less(lhs.first, rhs.first)) {
+         return true;
+      }
+      if(key_less(rhs.first, lhs.first)) {
+         return false;
+      }
+      return lhs.second < rhs.second;
+   }
+};
+
+/**
+ * The rules of an Ethernet ACL: those last committed, and the rule changes
+ * staged since, by sequence number. A staged change without a rule is a
+ * removal.
+ */
+struct acl_eth_rules {
+   void rule_set(uint32_t seq, acl_rule_eth_t const & rule) {
+      auto it = committed.find(seq);
+      if(it != committed.end() && it->second == rule) {
+         pending.erase(seq);
+      } else {
+         pending[seq] = std::unique_ptr<acl_rule_eth_t>(new acl_rule_eth_t(rule));
+      }
+   }
+
+   void rule_del(uint32_t seq) {
+      if(committed.count(seq)) {
+         pending[seq].reset();
+      } else {
+         pending.erase(seq);
+      }
+   }
+
+   void commit() {
+      for(auto & change : pending) {
+         if(change.second) {
+            committed[change.first] = *change.second;
+         } else {
+            committed.erase(change.first);
+         }
+      }
+      pending.clear();
+   }
+
+   std::map<uint32_t, acl_rule_eth_t> committed;
+   std::map<uint32_t, std::unique_ptr<acl_rule_eth_t>> pending;
+};
+
 class acl_mgr_impl : public acl_mgr {
  public:
    acl_mgr_impl() {
@@ -75,18 +153,55 @@ class acl_mgr_impl : public acl_mgr {
 
    void acl_apply(acl_key_t const & key, intf_id_t intf,
                   acl_direction_t direction, bool apply) {
+      if(direction != ACL_IN) {
+         return;
+      }
+      if(apply) {
+         applied_.insert(std::make_pair(key, intf));
+      } else {
+         applied_.erase(std::make_pair(key, intf));
+      }
    }
 
-   void acl_rule_set(acl_key_t const &, uint32_t, acl_rule_ip_t const &) {
+   void acl_rule_set(acl_key_t const & key, uint32_t seq,
+                     acl_rule_ip_t const & rule) {
+      auto & classifier = ip_acls_[key];
+      if(!classifier) {
+         classifier.reset(new acl_classifier_t());
+      }
+      classifier->rule_set(seq, rule);
    }
 
-   void acl_rule_set(acl_key_t const &, uint32_t, acl_rule_eth_t const &) {
+   void acl_rule_set(acl_key_t const & key, uint32_t seq,
+                     acl_rule_eth_t const & rule) {
+      eth_acls_[key].rule_set(seq, rule);
    }
 
-   void acl_rule_del(acl_key_t const &, uint32_t seq) {
+   void acl_rule_del(acl_key_t const & key, uint32_t seq) {
+      if(key.acl_type() == ACL_TYPE_ETH) {
+         auto it = eth_acls_.find(key);
+         if(it != eth_acls_.end()) {
+            it->second.rule_del(seq);
+         }
+         return;
+      }
+      auto it = ip_acls_.find(key);
+      if(it != ip_acls_.end()) {
+         it->second->rule_del(seq);
+      }
    }
 
-   void acl_del(acl_key_t const &) {
+   void acl_del(acl_key_t const & key) {
+      ip_acls_.erase(key);
+      eth_acls_.erase(key);
+      for(auto it = applied_.begin(); it != applied_.end();) {
+         if(it->first.acl_name() == key.acl_name() &&
+            it->first.acl_type() == key.acl_type()) {
+            it = applied_.erase(it);
+         } else {
+            ++it;
+         }
+      }
    }
 
    void acl_counters_enabled_set(acl_key_t const &, bool enabled) {
@@ -95,20 +210,157 @@ class acl_mgr_impl : public acl_mgr {
    void acl_fragments_enabled_set(acl_key_t const &, bool enabled) {
    }
 
-   bool dgram_allowed(ip_addr_t const &, ip_addr_t const &, uint16_t, uint16_t,
-                      uint8_t, uint8_t, intf_id_t const &) {
-      return true;
+   bool dgram_allowed(ip_addr_t const & src, ip_addr_t const & dst,
+                      uint16_t src_port, uint16_t dst_port, uint8_t ttl,
+                      uint8_t tos, intf_id_t const & intf) {
+      acl_packet_t packet(src, dst, 17, src_port, dst_port);  // UDP
+      packet.ttl_is(ttl);
+      packet.tos_is(tos);
+      return allowed(packet, &intf);
    }
 
-   bool stream_allowed(ip_addr_t const &, ip_addr_t const &, uint8_t, uint16_t,
-                       uint16_t) {
-      return true;
+   bool stream_allowed(ip_addr_t const & src, ip_addr_t const & dst,
+                       uint8_t protocol, uint16_t src_port, uint16_t dst_port) {
+      // Stream sockets are TCP unless the protocol says otherwise.
+      acl_packet_t packet(src, dst, protocol ? protocol : 6, src_port, dst_port);
+      return allowed(packet, NULL);
    }
 
    void acl_commit() {
+      std::vector<acl_key_t> keys;
+      for(auto const & acl : ip_acls_) {
+         keys.push_back(acl.first);
+      }
+      for(auto const & acl : eth_acls_) {
+         keys.push_back(acl.first);
+      }
+      acl_push(keys);
+      // Even with nothing pushed, the current state is reported.
+      sync_notify();
+   }
+
+   void acl_commit(std::vector<acl_key_t> const & keys) {
+      if(acl_push(keys)) {
+         sync_notify();
+      }
    }
+
+   void acl_discard(acl_key_t const & key) {
+      if(key.acl_type() == ACL_TYPE_ETH) {
+         auto it = eth_acls_.find(key);
+         if(it != eth_acls_.end()) {
+            it->second.pending.clear();
+         }
+         return;
+      }
+      auto it = find_acl(key);
+      if(it != ip_acls_.end()) {
+         it->second->rollback();
+      }
+   }
+
+   uint32_t acl_pending_rule_count(acl_key_t const & key) const {
+      if(key.acl_type() == ACL_TYPE_ETH) {
+         auto it = eth_acls_.find(key);
+         return it == eth_acls_.end() ? 0 : it->second.pending.size();
+      }
+      auto it = find_acl(key);
+      return it == ip_acls_.end() ? 0 : it->second->pending_count();
+   }
+
+ private:
+   /**
+    * Checks the packet against the IP ACLs applied inbound, either on the
+    * given interface or, if intf is NULL, on any interface.
+    */
+   bool allowed(acl_packet_t const & packet, intf_id_t const * intf) const {
+      acl_type_t type = packet.source_addr().af() == AF_IPV6 ?
+                        ACL_TYPE_IPV6 : ACL_TYPE_IPV4;
+      for(auto const & applied : applied_) {
+         if(applied.first.acl_type() != type ||
+            (intf && applied.second != *intf)) {
+            continue;
+         }
+         auto it = find_acl(applied.first);
+         if(it != ip_acls_.end() && it->second->classify(packet) == ACL_DENY) {
+            return false;
+         }
+      }
+      return true;
+   }
+
+   /**
+    * Commits the pending changes of the given ACLs, then calls
+    * on_acl_commit() for each of them, returning whether any was committed.
+    */
+   bool acl_push(std::vector<acl_key_t> const & keys) {
+      // Push every ACL first, and only then notify handlers, so that they
+      // never observe a partially committed transaction.
+      std::vector<std::pair<acl_key_t, uint32_t>> committed;
+      for(auto const & key : keys) {
+         if(key.acl_type() == ACL_TYPE_ETH) {
+            auto it = eth_acls_.find(key);
+            if(it == eth_acls_.end() || it->second.pending.empty()) {
+               continue;
+            }
+            committed.push_back(std::make_pair(it->first,
+                                               it->second.pending.size()));
+            it->second.commit();
+            continue;
+         }
+         auto it = find_acl(key);
+         if(it == ip_acls_.end() || !it->second->pending_count()) {
+            continue;
+         }
+         committed.push_back(std::make_pair(it->first,
+                                            it->second->pending_count()));
+         it->second->commit();
+      }
+      for(auto const & acl : committed) {
+         handler_foreach([&acl](acl_handler * handler) {
+            handler->on_acl_commit(acl.first, acl.second);
+         });
+      }
+      return !committed.empty();
+   }
+
+   void sync_notify() {
+      // There is no hardware to program: the commit is in sync right away.
+      handler_foreach([](acl_handler * handler) {
+         handler->on_acl_sync();
+      });
+   }
+
+   typedef std::map<acl_key_t, std::unique_ptr<acl_classifier_t>,
+                    acl_key_less> acl_map_t;
+
+   /// Looks up an IP ACL by name and type.
+   acl_map_t::const_iterator find_acl(acl_key_t const & key) const {
+      return ip_acls_.find(key);
+   }
+
+   acl_map_t ip_acls_;
+   std::map<acl_key_t, acl_eth_rules, acl_key_less> eth_acls_;
+   // The (ACL key, interface) pairs IP ACLs are applied inbound on.
+   std::set<std::pair<acl_key_t, intf_id_t>, acl_applied_less> applied_;
 };
 
+// -- pimpl wrappers to the ACL transaction functions
+
+void acl_mgr::acl_commit(std::vector<acl_key_t> const & keys) {
+   static_cast<acl_mgr_impl *>(this)->acl_commit(keys);
+}
+
+void acl_mgr::acl_discard(acl_key_t const & key) {
+   static_cast<acl_mgr_impl *>(this)->acl_discard(key);
+}
+
+uint32_t acl_mgr::acl_pending_rule_count(acl_key_t const & key) const {
+   return static_cast<acl_mgr_impl const *>(this)->acl_pending_rule_count(key);
+}
+
+// -- end of wrappers
+
 DEFINE_STUB_MGR_CTOR(acl_mgr)
 
 }  // end namespace eos
@@ -0,0 +1,483 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+#include "eos/acl_classifier.h"
+
+namespace eos {
+
+namespace {
+
+/// A 128 bit address, IPv4 addresses are stored in the top 32 bits.
+struct addr128 {
+   uint64_t hi;
+   uint64_t lo;
+};
+
+inline uint64_t load_be64(uint8_t const * bytes) {
+   uint64_t val = 0;
+   for(int i = 0; i < 8; ++i) {
+      val = (val << 8) | bytes[i];
+   }
+   return val;
+}
+
+inline addr128 to_addr128(ip_addr_t const & addr) {
+   addr128 result = { 0, 0 };
+   if(addr.af() == AF_IPV4) {
+      uint8_t const * bytes = addr.addr();
+      result.hi = (uint64_t(bytes[0]) << 56) | (uint64_t(bytes[1]) << 48) |
+                  (uint64_t(bytes[2]) << 40) | (uint64_t(bytes[3]) << 32);
+   } else if(addr.af() == AF_IPV6) {
+      result.hi = load_be64(addr.addr());
+      result.lo = load_be64(addr.addr() + 8);
+   }
+   return result;
+}
+
+inline addr128 mask(addr128 const & addr, uint8_t len) {
+   addr128 result = { 0, 0 };
+   if(len == 0) {
+      return result;
+   }
+   if(len <= 64) {
+      result.hi = addr.hi & (~uint64_t(0) << (64 - len));
+   } else {
+      result.hi = addr.hi;
+      result.lo = addr.lo & (~uint64_t(0) << (128 - len));
+   }
+   return result;
+}
+
+/// The masked source and destination addresses a tuple is hashed on.
+struct tuple_key {
+   addr128 src;
+   addr128 dst;
+
+   bool operator==(tuple_key const & other) const {
+      return src.hi == other.src.hi && src.lo == other.src.lo &&
+             dst.hi == other.dst.hi && dst.lo == other.dst.lo;
+   }
+};
+
+inline uint64_t mix64(uint64_t val) {
+   val ^= val >> 33;
+   val *= 0xff51afd7ed558ccdULL;
+   val ^= val >> 33;
+   return val;
+}
+
+struct tuple_key_hash {
+   size_t operator()(tuple_key const & key) const {
+      return mix64(key.src.hi ^ mix64(key.src.lo ^ mix64(key.dst.hi ^
+                                                          mix64(key.dst.lo))));
+   }
+};
+
+/// Copies the ports matched by a specifier, noting whether it matches all.
+void compile_ports(acl_port_spec_t const & spec, bool & any,
+                   acl_port_range_set_t & ports) {
+   auto const & ranges = spec.port_ranges().ranges();
+   any = ranges.size() == 1 && ranges.front().first == 0 &&
+         ranges.front().second == 65535;
+   if(!any) {
+      ports = spec.port_ranges();
+   }
+}
+
+/// The fields of a rule checked once its addresses have matched.
+struct compiled_rule {
+   uint32_t seq;
+   acl_action_t action;
+   bool matchable;
+   uint8_t ip_protocol;
+   bool any_source_port;
+   bool any_destination_port;
+   acl_port_range_set_t source_ports;
+   acl_port_range_set_t destination_ports;
+   acl_range_operator_t ttl_oper;
+   uint8_t ttl;
+   uint8_t priority_value;
+   uint8_t priority_mask;
+   bool priority_is_dscp;
+   uint16_t tcp_flags;
+   bool established;
+
+   bool matches(acl_packet_t const & packet) const {
+      if(!matchable) {
+         return false;
+      }
+      if(ip_protocol && ip_protocol != packet.ip_protocol()) {
+         return false;
+      }
+      if(!any_source_port && !source_ports.contains(packet.source_port())) {
+         return false;
+      }
+      if(!any_destination_port &&
+         !destination_ports.contains(packet.destination_port())) {
+         return false;
+      }
+      switch(ttl_oper) {
+       case ACL_RANGE_EQ:
+         if(packet.ttl() != ttl) return false;
+         break;
+       case ACL_RANGE_NEQ:
+         if(packet.ttl() == ttl) return false;
+         break;
+       case ACL_RANGE_GT:
+         if(packet.ttl() <= ttl) return false;
+         break;
+       case ACL_RANGE_LT:
+         if(packet.ttl() >= ttl) return false;
+         break;
+       default:
+         break;
+      }
+      if(priority_mask) {
+         uint8_t priority = priority_is_dscp ? packet.tos() >> 2 : packet.tos();
+         if((priority & priority_mask) != (priority_value & priority_mask)) {
+            return false;
+         }
+      }
+      if(tcp_flags && (packet.tcp_flags() & tcp_flags) != tcp_flags) {
+         return false;
+      }
+      if(established && !(packet.tcp_flags() & (ACL_TCP_ACK | ACL_TCP_RST))) {
+         return false;
+      }
+      return true;
+   }
+};
+
+/// All the rules matching on the same address family and prefix lengths.
+struct rule_tuple {
+   af_t af;  // AF_NULL if the rules match on no address at all
+   uint8_t source_len;
+   uint8_t destination_len;
+   uint32_t min_seq;
+   // The sequence numbers of all the rules in this tuple.
+   std::set<uint32_t> seqs;
+   // The rules of each masked address pair, in sequence number order.
+   std::unordered_map<tuple_key, std::vector<compiled_rule>, tuple_key_hash> rules;
+};
+
+/// The tuple a rule falls into: its address family and prefix lengths.
+typedef std::pair<af_t, uint16_t> tuple_id;
+
+}  // namespace
+
+class acl_classifier_internal {
+ public:
+   void rule_set(uint32_t seq, acl_rule_ip_t const & rule) {
+      auto it = committed.find(seq);
+      if(it != committed.end() && acl_rule_ip_equal(it->second, rule)) {
+         // Setting a rule back to its committed value cancels the change.
+         pending.erase(seq);
+      } else {
+         pending[seq] = std::make_pair(true, rule);
+      }
+   }
+
+   void rule_del(uint32_t seq) {
+      if(committed.find(seq) == committed.end()) {
+         pending.erase(seq);
+      } else {
+         pending[seq] = std::make_pair(false, acl_rule_ip_t());
+      }
+   }
+
+   void rules_clear() {
+      pending.clear();
+      for(auto const & entry : committed) {
+         pending[entry.first] = std::make_pair(false, acl_rule_ip_t());
+      }
+   }
+
+   void commit() {
+      if(pending.empty()) {
+         return;
+      }
+      // Past some point, patching the tuples rule by rule costs more than
+      // compiling the whole ACL again.
+      bool rebuild = pending.size() > committed.size() / 2;
+      for(auto const & change : pending) {
+         uint32_t seq = change.first;
+         auto it = committed.find(seq);
+         if(it != committed.end()) {
+            if(!rebuild) {
+               rule_remove(seq, it->second);
+            }
+            committed.erase(it);
+         }
+         if(change.second.first) {
+            if(!rebuild) {
+               rule_insert(seq, change.second.second);
+            }
+            committed.emplace(seq, change.second.second);
+         }
+      }
+      pending.clear();
+      if(rebuild) {
+         compile();
+      } else {
+         tuples_sort();
+      }
+   }
+
+   /// Compiles all the committed rules from scratch.
+   void compile() {
+      tuples.clear();
+      tuple_index.clear();
+      // Rules are visited in sequence number order, so every rule list ends
+      // up sorted without further work.
+      for(auto const & entry : committed) {
+         uint8_t src_len, dst_len;
+         tuple_key addrs;
+         af_t af = classify_rule(entry.second, src_len, dst_len, addrs);
+         rule_tuple & tuple = tuple_get(af, src_len, dst_len);
+         tuple.seqs.insert(tuple.seqs.end(), entry.first);
+         tuple.rules[addrs].push_back(compile_rule(entry.first, entry.second, af));
+      }
+      tuples_sort();
+   }
+
+   /**
+    * Returns the address family of a rule, and fills in the prefix lengths
+    * and masked addresses it is matched on.
+    */
+   static af_t classify_rule(acl_rule_ip_t const & rule, uint8_t & src_len,
+                             uint8_t & dst_len, tuple_key & addrs) {
+      ip_addr_mask_t src = rule.source_addr();
+      ip_addr_mask_t dst = rule.destination_addr();
+      af_t af = src.af() != AF_NULL ? src.af() : dst.af();
+      src_len = src.af() == AF_NULL ? 0 : src.mask_length();
+      dst_len = dst.af() == AF_NULL ? 0 : dst.mask_length();
+      if(af == AF_IPV4) {
+         src_len = std::min<uint8_t>(src_len, 32);
+         dst_len = std::min<uint8_t>(dst_len, 32);
+      }
+      addrs.src = mask(to_addr128(src.addr()), src_len);
+      addrs.dst = mask(to_addr128(dst.addr()), dst_len);
+      return af;
+   }
+
+   /// Returns the tuple for the given prefix lengths, creating it if needed.
+   rule_tuple & tuple_get(af_t af, uint8_t src_len, uint8_t dst_len) {
+      tuple_id id = std::make_pair(af, uint16_t(src_len << 8 | dst_len));
+      auto it = tuple_index.find(id);
+      if(it == tuple_index.end()) {
+         it = tuple_index.emplace(id, tuples.size()).first;
+         tuples.emplace_back();
+         tuples.back().af = af;
+         tuples.back().source_len = src_len;
+         tuples.back().destination_len = dst_len;
+      }
+      return tuples[it->second];
+   }
+
+   void rule_insert(uint32_t seq, acl_rule_ip_t const & rule) {
+      uint8_t src_len, dst_len;
+      tuple_key addrs;
+      af_t af = classify_rule(rule, src_len, dst_len, addrs);
+      rule_tuple & tuple = tuple_get(af, src_len, dst_len);
+      tuple.seqs.insert(seq);
+      std::vector<compiled_rule> & rules = tuple.rules[addrs];
+      auto pos = std::lower_bound(
+         rules.begin(), rules.end(), seq,
+         [](compiled_rule const & r, uint32_t s) { return r.seq < s; });
+      rules.insert(pos, compile_rule(seq, rule, af));
+   }
+
+   void rule_remove(uint32_t seq, acl_rule_ip_t const & rule) {
+      uint8_t src_len, dst_len;
+      tuple_key addrs;
+      af_t af = classify_rule(rule, src_len, dst_len, addrs);
+      rule_tuple & tuple = tuple_get(af, src_len, dst_len);
+      tuple.seqs.erase(seq);
+      auto it = tuple.rules.find(addrs);
+      if(it == tuple.rules.end()) {
+         return;
+      }
+      std::vector<compiled_rule> & rules = it->second;
+      auto pos = std::lower_bound(
+         rules.begin(), rules.end(), seq,
+         [](compiled_rule const & r, uint32_t s) { return r.seq < s; });
+      if(pos != rules.end() && pos->seq == seq) {
+         rules.erase(pos);
+      }
+      if(rules.empty()) {
+         tuple.rules.erase(it);
+      }
+   }
+
+   /**
+    * Drops empty tuples, and orders the others so that tuples holding the
+    * lowest sequence numbers are probed first: a lookup can then stop as
+    * soon as no remaining tuple can hold a better match.
+    */
+   void tuples_sort() {
+      tuples.erase(std::remove_if(tuples.begin(), tuples.end(),
+                                  [](rule_tuple const & tuple) {
+                                     return tuple.seqs.empty();
+                                  }),
+                   tuples.end());
+      for(auto & tuple : tuples) {
+         tuple.min_seq = *tuple.seqs.begin();
+      }
+      std::sort(tuples.begin(), tuples.end(),
+                [](rule_tuple const & a, rule_tuple const & b) {
+                   return a.min_seq < b.min_seq;
+                });
+      tuple_index.clear();
+      for(size_t i = 0; i < tuples.size(); ++i) {
+         tuple_index.emplace(std::make_pair(tuples[i].af,
+                                            uint16_t(tuples[i].source_len << 8 |
+                                                     tuples[i].destination_len)),
+                             i);
+      }
+   }
+
+   static compiled_rule compile_rule(uint32_t seq, acl_rule_ip_t const & rule,
+                                     af_t af) {
+      compiled_rule compiled;
+      compiled.seq = seq;
+      compiled.action = rule.action();
+      compiled.matchable = !rule.vlan() && !rule.inner_vlan() &&
+                           rule.nexthop_group().empty() &&
+                           !rule.match_fragments() &&
+                           rule.icmp_type() == ALL_ICMP &&
+                           rule.icmp_code() == ALL_ICMP;
+      compiled.ip_protocol = rule.ip_protocol();
+      compile_ports(rule.source_port(), compiled.any_source_port,
+                    compiled.source_ports);
+      compile_ports(rule.destination_port(), compiled.any_destination_port,
+                    compiled.destination_ports);
+      compiled.ttl_oper = rule.ttl().oper();
+      compiled.ttl = rule.ttl().ttl();
+      compiled.priority_is_dscp = af != AF_IPV6;
+      compiled.priority_value = rule.priority_value();
+      compiled.priority_mask = (af == AF_IPV6 || rule.match_ip_priority()) ?
+                               rule.priority_mask() : 0;
+      compiled.tcp_flags = rule.tcp_flags();
+      compiled.established = rule.established();
+      return compiled;
+   }
+
+   compiled_rule const * lookup(acl_packet_t const & packet) const {
+      af_t af = packet.source_addr().af();
+      addr128 src = to_addr128(packet.source_addr());
+      addr128 dst = to_addr128(packet.destination_addr());
+      compiled_rule const * best = NULL;
+      for(auto const & tuple : tuples) {
+         if(best && tuple.min_seq > best->seq) {
+            break;
+         }
+         if(tuple.af != AF_NULL && tuple.af != af) {
+            continue;
+         }
+         tuple_key key = { mask(src, tuple.source_len),
+                           mask(dst, tuple.destination_len) };
+         auto it = tuple.rules.find(key);
+         if(it == tuple.rules.end()) {
+            continue;
+         }
+         for(auto const & rule : it->second) {
+            if(best && rule.seq > best->seq) {
+               break;
+            }
+            if(rule.matches(packet)) {
+               best = &rule;
+               break;
+            }
+         }
+      }
+      return best;
+   }
+
+   std::map<uint32_t, acl_rule_ip_t> committed;
+   // The staged changes, by sequence number: true and the new rule if the
+   // rule is set, false if it is removed.
+   std::map<uint32_t, std::pair<bool, acl_rule_ip_t>> pending;
+   std::vector<rule_tuple> tuples;
+   std::map<tuple_id, size_t> tuple_index;
+};
+
+acl_classifier_t::acl_classifier_t() : classifier_(new acl_classifier_internal()) {
+}
+
+acl_classifier_t::~acl_classifier_t() {
+   delete classifier_;
+}
+
+void
+acl_classifier_t::rule_set(uint32_t seq, acl_rule_ip_t const & rule) {
+   classifier_->rule_set(seq, rule);
+}
+
+void
+acl_classifier_t::rule_del(uint32_t seq) {
+   classifier_->rule_del(seq);
+}
+
+void
+acl_classifier_t::rules_clear() {
+   classifier_->rules_clear();
+}
+
+void
+acl_classifier_t::commit() {
+   classifier_->commit();
+}
+
+void
+acl_classifier_t::rollback() {
+   classifier_->pending.clear();
+}
+
+uint32_t
+acl_classifier_t::rule_count() const {
+   return classifier_->committed.size();
+}
+
+uint32_t
+acl_classifier_t::pending_count() const {
+   return classifier_->pending.size();
+}
+
+uint32_t
+acl_classifier_t::match(acl_packet_t const & packet) const {
+   compiled_rule const * rule = classifier_->lookup(packet);
+   return rule ? rule->seq : 0;
+}
+
+acl_action_t
+acl_classifier_t::classify(acl_packet_t const & packet) const {
+   compiled_rule const * rule = classifier_->lookup(packet);
+   return rule ? rule->action : ACL_DENY;
+}
+
+void
+acl_classifier_t::classify(std::vector<acl_packet_t> const & packets,
+                           std::vector<acl_action_t> & actions) const {
+   actions.resize(packets.size());
+   for(size_t i = 0; i < packets.size(); ++i) {
+      compiled_rule const * rule = classifier_->lookup(packets[i]);
+      actions[i] = rule ? rule->action : ACL_DENY;
+   }
+}
+
+void
+acl_classifier_t::match(std::vector<acl_packet_t> const & packets,
+                        std::vector<uint32_t> & seqs) const {
+   seqs.resize(packets.size());
+   for(size_t i = 0; i < packets.size(); ++i) {
+      compiled_rule const * rule = classifier_->lookup(packets[i]);
+      seqs[i] = rule ? rule->seq : 0;
+   }
+}
+
+}  // namespace eos
@@ -64,6 +64,18 @@ acl_port_spec_t::acl_port_spec_t(acl_range_operator_t oper,
       oper,
       ports
    )) {}
+acl_port_spec_t::acl_port_spec_t(acl_range_operator_t oper, uint16_t port) :
+   pimpl(std::make_shared<acl_port_spec_impl_t>(
+      oper,
+      port
+   )) {}
+acl_port_spec_t::acl_port_spec_t(acl_range_operator_t oper, uint16_t low,
+                                 uint16_t high) :
+   pimpl(std::make_shared<acl_port_spec_impl_t>(
+      oper,
+      low,
+      high
+   )) {}
 EOS_SDK_PUBLIC acl_port_spec_t::acl_port_spec_t(
    const acl_port_spec_t& other) :
    pimpl(std::make_shared<acl_port_spec_impl_t>(
@@ -1,7 +1,11 @@
 // Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
+#include <set>
+
 #include <eos/bfd.h>
+#include <eos/bfd_bulk.h>
+#include <eos/timer.h>
 #include <impl.h>
 
 namespace eos {
@@ -18,17 +22,67 @@ class bfd_session_mgr_impl : public bfd_session_mgr {
    }
 
    bool exists(bfd_session_key_t const & key) const {
-      return false;
+      return sessions_.count(key) != 0;
    }
 
    void session_set(bfd_session_key_t const & key) {
+      sessions_set(std::vector<bfd_session_key_t>(1, key));
    }
 
    bfd_session_t session(bfd_session_key_t const & key) const {
-      return eos::bfd_session_t();
+      if(!exists(key)) {
+         return eos::bfd_session_t();
+      }
+      return eos::bfd_session_t(key, session_status(key));
    }
 
    void session_del(bfd_session_key_t const & key) {
+      sessions_del(std::vector<bfd_session_key_t>(1, key));
+   }
+
+   void sessions_set(std::vector<bfd_session_key_t> const & keys) {
+      std::vector<bfd_session_key_t> created;
+      for(auto const & key : keys) {
+         if(sessions_.insert(key).second) {
+            created.push_back(key);
+         }
+      }
+      for(auto const & key : created) {
+         handler_foreach(key, [&](bfd_session_handler * handler) {
+            handler->on_bfd_session_set(key);
+         });
+      }
+   }
+
+   void sessions_del(std::vector<bfd_session_key_t> const & keys) {
+      std::vector<bfd_session_key_t> deleted;
+      for(auto const & key : keys) {
+         if(sessions_.erase(key)) {
+            deleted.push_back(key);
+         }
+      }
+      for(auto const & key : deleted) {
+         handler_foreach(key, [&](bfd_session_handler * handler) {
+            handler->on_bfd_session_del(key);
+         });
+      }
+   }
+
+   void session_status_snapshot(bfd_session_status_snapshot_t & snapshot) const {
+      snapshot.clear();
+      for(auto const & key : sessions_) {
+         snapshot.status_add(key, session_status(key));
+      }
+      snapshot.timestamp_is(now());
+   }
+
+   void session_status_snapshot(std::vector<bfd_session_key_t> const & keys,
+                                bfd_session_status_snapshot_t & snapshot) const {
+      snapshot.clear();
+      for(auto const & key : keys) {
+         snapshot.status_add(key, session_status(key));
+      }
+      snapshot.timestamp_is(now());
    }
 
    void default_interval_is(bfd_interval_t const & cfg) {
@@ -81,16 +135,60 @@ class bfd_session_mgr_impl : public bfd_session_mgr {
    sbfd_echo_session_status( sbfd_echo_session_key_t const & ) const {
       return eos::BFD_SESSION_STATUS_NULL;
    }
+
+ private:
+   std::set<bfd_session_key_t> sessions_;
 };
 
+// -- pimpl wrappers to the batched session calls and status snapshots
+
+void
+bfd_session_mgr::sessions_set(std::vector<bfd_session_key_t> const & keys) {
+   static_cast<bfd_session_mgr_impl *>(this)->sessions_set(keys);
+}
+
+void
+bfd_session_mgr::sessions_del(std::vector<bfd_session_key_t> const & keys) {
+   static_cast<bfd_session_mgr_impl *>(this)->sessions_del(keys);
+}
+
+void
+bfd_session_mgr::session_status_snapshot(
+      bfd_session_status_snapshot_t & snapshot) const {
+   static_cast<bfd_session_mgr_impl const *>(this)->session_status_snapshot(
+      snapshot);
+}
+
+void
+bfd_session_mgr::session_status_snapshot(
+      std::vector<bfd_session_key_t> const & keys,
+      bfd_session_status_snapshot_t & snapshot) const {
+   static_cast<bfd_session_mgr_impl const *>(this)->session_status_snapshot(
+      keys, snapshot);
+}
+
+// -- end of wrappers
+
 DEFINE_STUB_MGR_CTOR(bfd_session_mgr)
 
 bfd_session_handler::bfd_session_handler(bfd_session_mgr *mgr) : base_handler(mgr) {
 }
 
-void bfd_session_handler::watch_all_bfd_sessions(bool) {}
+void bfd_session_handler::watch_all_bfd_sessions(bool should_watch) {
+   if(should_watch) {
+      mgr_->add_handler(this);
+   } else {
+      mgr_->remove_handler(this);
+   }
+}
 void bfd_session_handler::watch_bfd_session(bfd_session_key_t const & key,
-                                            bool watch) {}
+                                            bool should_watch) {
+   if(should_watch) {
+      mgr_->add_handler(key, this);
+   } else {
+      mgr_->remove_handler(key, this);
+   }
+}
 void bfd_session_handler::on_bfd_session_status(bfd_session_key_t const & key, 
                                                 bfd_session_status_t new_status) {}
 void bfd_session_handler::on_bfd_session_set(bfd_session_key_t const & key) {}
@@ -0,0 +1,62 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <algorithm>
+
+#include "eos/bfd_bulk.h"
+
+namespace eos {
+
+bfd_session_status_snapshot_t::bfd_session_status_snapshot_t() : timestamp_(0) {
+}
+
+void
+bfd_session_status_snapshot_t::clear() {
+   timestamp_ = 0;
+   keys_.clear();
+   statuses_.clear();
+}
+
+void
+bfd_session_status_snapshot_t::status_add(bfd_session_key_t const & key,
+                                          bfd_session_status_t status) {
+   keys_.push_back(key);
+   statuses_.push_back(status);
+}
+
+seconds_t
+bfd_session_status_snapshot_t::timestamp() const {
+   return timestamp_;
+}
+
+void
+bfd_session_status_snapshot_t::timestamp_is(seconds_t timestamp) {
+   timestamp_ = timestamp;
+}
+
+size_t
+bfd_session_status_snapshot_t::size() const {
+   return keys_.size();
+}
+
+bfd_session_key_t const &
+bfd_session_status_snapshot_t::key(size_t row) const {
+   return keys_[row];
+}
+
+bfd_session_status_t
+bfd_session_status_snapshot_t::status(size_t row) const {
+   return statuses_[row];
+}
+
+bfd_session_status_t const *
+bfd_session_status_snapshot_t::statuses() const {
+   return statuses_.data();
+}
+
+size_t
+bfd_session_status_snapshot_t::status_count(bfd_session_status_t status) const {
+   return std::count(statuses_.begin(), statuses_.end(), status);
+}
+
+}  // namespace eos
@@ -1,11 +1,58 @@
 // Copyright (c) 2019 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
+#include "bgp_path_rib.h"
 #include "eos/bgp_path.h"
+#include "eos/types/bgp_path_impl.h"
 #include "impl.h"
+#include "intern.h"
 
 namespace eos {
 
+bgp_path_attr_impl_t::community_list_data::community_list_data(
+      std::vector<uint32_t> const & sorted) : sorted(sorted) {
+}
+
+bgp_path_attr_impl_t::community_list_data::community_list_data(
+      community_list_data const & other) : sorted(other.sorted) {
+}
+
+std::unordered_set<uint32_t> const &
+bgp_path_attr_impl_t::community_list_data::set() const {
+   // Interned lists are shared across threads.
+   std::call_once(set_built_, [this] {
+      set_.insert(sorted.begin(), sorted.end());
+   });
+   return set_;
+}
+
+uint32_t
+bgp_path_attr_impl_t::community_list_data::hash() const {
+   hash_mix h;
+   for(uint32_t community : sorted) {
+      h.mix(community);
+   }
+   return h.result();
+}
+
+bool
+bgp_path_attr_impl_t::community_list_data::operator==(
+      community_list_data const & other) const {
+   return sorted == other.sorted;
+}
+
+std::shared_ptr<bgp_path_attr_impl_t::community_list_data const>
+bgp_path_attr_impl_t::community_list_intern(
+      std::vector<uint32_t> const & community_list) {
+   if(community_list.empty()) {
+      return nullptr;
+   }
+   // Never destroyed, so that lists can outlive static destruction.
+   static intern_table<community_list_data> * lists =
+      new intern_table<community_list_data>();
+   return lists->intern(community_list_data(community_list));
+}
+
 class bgp_path_mgr_impl : public bgp_path_mgr {
  public:
    bgp_path_iter_t ipv4_unicast_path_iter(bgp_path_options_t & options) const {
@@ -13,41 +60,189 @@ class bgp_path_mgr_impl : public bgp_path_mgr {
       return *nop;
    }
 
+   std::vector<bgp_path_t> ipv4_unicast_paths(
+         bgp_path_options_t & options) const {
+      return ipv4_paths_.paths(options);
+   }
+
    bgp_path_t ipv4_unicast_path(bgp_path_key_t const & path_key,
                                 bgp_path_options_t & options) {
-      return bgp_path_t();
+      return ipv4_paths_.path(path_key, options);
    }
 
    bool ipv4_unicast_bgp_convergence() {
       return false;
    }
 
+   uint64_t ipv4_unicast_path_seq() const {
+      return ipv4_paths_.seq();
+   }
+
+   bool ipv4_unicast_path_changes(
+         uint64_t seq, bgp_path_options_t const & options, size_t max_changes,
+         std::vector<bgp_path_change_t> & changes) const {
+      return ipv4_paths_.changes(seq, options, max_changes, changes);
+   }
+
    bgp_path_iter_t ipv6_unicast_path_iter(bgp_path_options_t & options) const {
       bgp_path_iter_t *nop = 0;
       return *nop;
    }
 
+   std::vector<bgp_path_t> ipv6_unicast_paths(
+         bgp_path_options_t & options) const {
+      return ipv6_paths_.paths(options);
+   }
+
    bgp_path_t ipv6_unicast_path(bgp_path_key_t const & path_key,
                                 bgp_path_options_t & options) {
-      return bgp_path_t();
+      return ipv6_paths_.path(path_key, options);
    }
 
    bool ipv6_unicast_bgp_convergence() {
       return false;
    }
+
+   uint64_t ipv6_unicast_path_seq() const {
+      return ipv6_paths_.seq();
+   }
+
+   bool ipv6_unicast_path_changes(
+         uint64_t seq, bgp_path_options_t const & options, size_t max_changes,
+         std::vector<bgp_path_change_t> & changes) const {
+      return ipv6_paths_.changes(seq, options, max_changes, changes);
+   }
+
+   /**
+    * Updates the IPv4 Unicast paths of Adj-RIB-In with the paths received
+    * from the peers: adds or replaces the paths set, removes the paths
+    * withdrawn, then notifies the handlers of the paths that changed, and
+    * of the changes as one batch.
+    */
+   void ipv4_unicast_paths_update(std::vector<bgp_path_t> const & paths_set,
+                                  std::vector<bgp_path_key_t> const & paths_del) {
+      paths_update(BGP_IPV4_UNICAST, ipv4_paths_, paths_set, paths_del);
+   }
+
+   /// Same as ipv4_unicast_paths_update(), for IPv6 Unicast paths.
+   void ipv6_unicast_paths_update(std::vector<bgp_path_t> const & paths_set,
+                                  std::vector<bgp_path_key_t> const & paths_del) {
+      paths_update(BGP_IPV6_UNICAST, ipv6_paths_, paths_set, paths_del);
+   }
+
+ private:
+   void paths_update(bgp_afi_safi_t afi_safi, bgp_path_rib & rib,
+                     std::vector<bgp_path_t> const & paths_set,
+                     std::vector<bgp_path_key_t> const & paths_del) {
+      uint64_t seq = rib.seq();
+      for(auto const & path : paths_set) {
+         rib.path_set(path.path_key(), path.path_attr());
+      }
+      for(auto const & key : paths_del) {
+         rib.path_del(key);
+      }
+      if(rib.seq() == seq) {
+         return;
+      }
+      // The changes of the update are notified as one batch, after each
+      // path was notified on its own.
+      bgp_path_attr_fields_t fields(true);
+      fields.community_list_is(true);
+      bgp_path_options_t options;
+      options.path_attr_fields_is(fields);
+      std::vector<bgp_path_change_t> changes;
+      rib.changes(seq, options, 0, changes);
+      handler_foreach(afi_safi, [&](bgp_path_handler * handler) {
+         for(auto const & change : changes) {
+            if(afi_safi == BGP_IPV4_UNICAST) {
+               handler->on_ipv4_unicast_path(change.path().path_key());
+            } else {
+               handler->on_ipv6_unicast_path(change.path().path_key());
+            }
+         }
+         if(afi_safi == BGP_IPV4_UNICAST) {
+            handler->on_ipv4_unicast_path_changes(changes);
+         } else {
+            handler->on_ipv6_unicast_path_changes(changes);
+         }
+      });
+   }
+
+   bgp_path_rib ipv4_paths_;
+   bgp_path_rib ipv6_paths_;
 };
 
+// -- pimpl wrappers to the paged path lookups and the path change stream
+
+std::vector<bgp_path_t>
+bgp_path_mgr::ipv4_unicast_paths(bgp_path_options_t & options) const {
+   return static_cast<bgp_path_mgr_impl const *>(this)->ipv4_unicast_paths(
+      options);
+}
+
+std::vector<bgp_path_t>
+bgp_path_mgr::ipv6_unicast_paths(bgp_path_options_t & options) const {
+   return static_cast<bgp_path_mgr_impl const *>(this)->ipv6_unicast_paths(
+      options);
+}
+
+uint64_t
+bgp_path_mgr::ipv4_unicast_path_seq() const {
+   return static_cast<bgp_path_mgr_impl const *>(this)->ipv4_unicast_path_seq();
+}
+
+bool
+bgp_path_mgr::ipv4_unicast_path_changes(
+      uint64_t seq, bgp_path_options_t const & options, size_t max_changes,
+      std::vector<bgp_path_change_t> & changes) const {
+   return static_cast<bgp_path_mgr_impl const *>(this)->ipv4_unicast_path_changes(
+      seq, options, max_changes, changes);
+}
+
+uint64_t
+bgp_path_mgr::ipv6_unicast_path_seq() const {
+   return static_cast<bgp_path_mgr_impl const *>(this)->ipv6_unicast_path_seq();
+}
+
+bool
+bgp_path_mgr::ipv6_unicast_path_changes(
+      uint64_t seq, bgp_path_options_t const & options, size_t max_changes,
+      std::vector<bgp_path_change_t> & changes) const {
+   return static_cast<bgp_path_mgr_impl const *>(this)->ipv6_unicast_path_changes(
+      seq, options, max_changes, changes);
+}
+
+// -- end of wrappers
+
 DEFINE_STUB_MGR_CTOR(bgp_path_mgr)
 
 bgp_path_handler::bgp_path_handler(bgp_path_mgr * mgr) :
       base_handler<bgp_path_mgr, bgp_path_handler>(mgr) {
 }
 
-void bgp_path_handler::watch_all_paths(bool) {}
+void bgp_path_handler::watch_all_paths(bool should_watch) {
+   if(should_watch) {
+      mgr_->add_handler(this);
+   } else {
+      mgr_->remove_handler(this);
+   }
+}
 
-void bgp_path_handler::watch_ipv4_unicast_paths(bool) {}
+void bgp_path_handler::watch_ipv4_unicast_paths(bool should_watch) {
+   if(should_watch) {
+      mgr_->add_handler(BGP_IPV4_UNICAST, this);
+   } else {
+      mgr_->remove_handler(BGP_IPV4_UNICAST, this);
+   }
+}
 
-void bgp_path_handler::watch_ipv6_unicast_paths(bool) {}
+void bgp_path_handler::watch_ipv6_unicast_paths(bool should_watch) {
+   if(should_watch) {
+      mgr_->add_handler(BGP_IPV6_UNICAST, this);
+   } else {
+      mgr_->remove_handler(BGP_IPV6_UNICAST, this);
+   }
+}
 
 void bgp_path_handler::on_ipv4_unicast_path(bgp_path_key_t const & path_key) {}
 
@@ -57,4 +252,10 @@ void bgp_path_handler::on_ipv6_unicast_path(bgp_path_key_t const & path_key) {}
 
 void bgp_path_handler::on_ipv6_unicast_bgp_converged(bool converged) {}
 
+void bgp_path_handler::on_ipv4_unicast_path_changes(
+      std::vector<bgp_path_change_t> const & changes) {}
+
+void bgp_path_handler::on_ipv6_unicast_path_changes(
+      std::vector<bgp_path_change_t> const & changes) {}
+
 } // namespace eos
@@ -238,4 +238,50 @@ bgp_path_t::operator delete( void * p ) noexcept {
 }
 
 
+
+bgp_path_change_t::bgp_path_change_t() :
+   pimpl(std::make_shared<bgp_path_change_impl_t>()) {}
+bgp_path_change_t::bgp_path_change_t(uint64_t seq, bgp_path_change_type_t type,
+                                     bgp_path_t const & path) :
+   pimpl(std::make_shared<bgp_path_change_impl_t>(
+      seq, type, path
+   )) {}
+EOS_SDK_PUBLIC bgp_path_change_t::bgp_path_change_t(
+   const bgp_path_change_t& other) :
+   pimpl(std::make_shared<bgp_path_change_impl_t>(
+      *other.pimpl)) {}
+EOS_SDK_PUBLIC bgp_path_change_t&
+bgp_path_change_t::operator=(
+   bgp_path_change_t const & other)
+{
+   if(this != &other) {
+      pimpl = std::make_shared<bgp_path_change_impl_t>(
+         *other.pimpl);
+   }
+   return *this;
+}
+
+EOS_SDK_PUBLIC bgp_path_change_t::bgp_path_change_t(
+   bgp_path_change_t && other) noexcept  :
+   pimpl(std::move(other.pimpl)) {}
+EOS_SDK_PUBLIC bgp_path_change_t&
+bgp_path_change_t::operator=(
+   bgp_path_change_t && other) noexcept 
+{
+   if(this != &other) {
+      std::swap(pimpl, other.pimpl);
+   }
+   return *this;
+}
+
+EOS_SDK_PUBLIC void *
+bgp_path_change_t::operator new( std::size_t size ) {
+   return ::operator new( size );
+}
+EOS_SDK_PUBLIC void
+bgp_path_change_t::operator delete( void * p ) noexcept {
+   ::operator delete( p );
+}
+
+
 } // namespace eos
@@ -0,0 +1,358 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include "bgp_path_rib.h"
+#include "eos/exception.h"
+#include "eos/ip.h"
+#include "eos/panic.h"
+
+namespace eos {
+
+namespace {
+
+/// Returns the number of address bytes of a family.
+size_t addr_len(af_t af) {
+   return af == AF_IPV4 ? 4 : 16;
+}
+
+/// Returns the last address of a prefix.
+ip_addr_t prefix_last(ip_prefix_t const & prefix) {
+   ip_addr_t network = prefix.network();
+   ip_addr_t mask = prefix.mask();
+   uint8_t addr[16];
+   for(size_t i = 0; i < addr_len(network.af()); ++i) {
+      addr[i] = network.addr()[i] | ~mask.addr()[i];
+   }
+   return ip_addr_t(network.af(), addr);
+}
+
+/// Returns true if prefix is outer or one of the more specific prefixes it
+/// contains.
+bool prefix_contains(ip_prefix_t const & outer, ip_prefix_t const & prefix) {
+   if(prefix.af() != outer.af() ||
+      prefix.prefix_length() < outer.prefix_length()) {
+      return false;
+   }
+   ip_addr_t addr = prefix.network();
+   ip_addr_t network = outer.network();
+   ip_addr_t mask = outer.mask();
+   for(size_t i = 0; i < addr_len(network.af()); ++i) {
+      if((addr.addr()[i] & mask.addr()[i]) != network.addr()[i]) {
+         return false;
+      }
+   }
+   return true;
+}
+
+/// A range of prefixes, by network address.
+struct prefix_range {
+   ip_addr_t first;
+   ip_addr_t last;
+};
+
+/**
+ * Returns the ranges of networks covered by some prefixes, in address
+ * order and without overlaps.
+ */
+std::vector<prefix_range> prefix_ranges(std::set<ip_prefix_t> const & prefixes) {
+   std::vector<prefix_range> ranges;
+   // The prefixes are ordered by network address.
+   for(auto const & prefix : prefixes) {
+      ip_addr_t last = prefix_last(prefix);
+      if(!ranges.empty() && ranges.back().last.af() == prefix.af() &&
+         !(ranges.back().last < prefix.network())) {
+         ranges.back().last = std::max(ranges.back().last, last);
+      } else {
+         ranges.push_back(prefix_range{prefix.network(), last});
+      }
+   }
+   return ranges;
+}
+
+/**
+ * A page token is the key of the last path returned, as
+ * "<network>/<length> <peer> <vrf>".
+ */
+std::string page_token(bgp_path_key_t const & key) {
+   std::ostringstream ss;
+   ss << key.prefix().network().to_string() << "/"
+      << int(key.prefix().prefix_length()) << " "
+      << key.peer_addr().to_string() << " " << key.vrf_name();
+   return ss.str();
+}
+
+bool page_token_parse(std::string const & token, bgp_path_key_t * key) {
+   size_t slash = token.find('/');
+   size_t space = token.find(' ');
+   if(slash == std::string::npos || space == std::string::npos ||
+      space < slash) {
+      return false;
+   }
+   size_t peer_end = token.find(' ', space + 1);
+   if(peer_end == std::string::npos) {
+      return false;
+   }
+   ip_addr_t network;
+   ip_addr_t peer;
+   if(!parse_ip_addr(token.substr(0, slash).c_str(), &network) ||
+      !parse_ip_addr(token.substr(space + 1, peer_end - space - 1).c_str(),
+                     &peer)) {
+      return false;
+   }
+   uint8_t length = strtoul(token.c_str() + slash + 1, NULL, 10);
+   *key = bgp_path_key_t(ip_prefix_t(network, length), peer,
+                         token.substr(peer_end + 1));
+   return true;
+}
+
+/// Returns true if the attributes of a path match the options.
+bool attr_match(bgp_path_attr_t const & attr,
+                bgp_path_options_t const & options) {
+   if(!options.next_hops().empty() &&
+      !options.next_hops().count(attr.next_hop())) {
+      return false;
+   }
+   auto const & communities = options.communities();
+   if(!communities.empty()) {
+      auto const & path_communities = attr.community_list_sorted();
+      // Probe the smaller of the two lists.
+      if(path_communities.size() < communities.size()) {
+         for(auto community : path_communities) {
+            if(communities.count(community)) {
+               return true;
+            }
+         }
+      } else {
+         for(auto community : communities) {
+            if(attr.community_list_contains(community)) {
+               return true;
+            }
+         }
+      }
+      return false;
+   }
+   return true;
+}
+
+/// Returns true if the key of a path matches the options.
+bool key_match(bgp_path_key_t const & key, bgp_path_options_t const & options) {
+   if(!options.peer_addrs().empty() &&
+      !options.peer_addrs().count(key.peer_addr())) {
+      return false;
+   }
+   if(!options.prefixes().empty()) {
+      ip_prefix_t prefix = key.prefix();
+      for(auto const & outer : options.prefixes()) {
+         if(prefix_contains(outer, prefix)) {
+            return true;
+         }
+      }
+      return false;
+   }
+   return true;
+}
+
+/// Builds a path with the attributes requested by the options.
+bgp_path_t path_project(bgp_path_key_t const & key, bgp_path_attr_t const & attr,
+                        bgp_path_options_t const & options) {
+   bgp_path_attr_fields_t fields = options.path_attr_fields();
+   // Copying the attributes shares their community list.
+   bgp_path_attr_t result(attr);
+   if(!fields.next_hop()) {
+      result.next_hop_is(ip_addr_t());
+   }
+   if(!fields.community_list()) {
+      result.community_list_sorted_is(std::vector<uint32_t>());
+   }
+   bgp_path_t path(key);
+   path.path_attr_is(result);
+   return path;
+}
+
+}  // namespace
+
+bgp_path_rib::bgp_path_rib(size_t history) :
+      history_(std::max<size_t>(history, 1)), seq_(0) {
+}
+
+void
+bgp_path_rib::path_set(bgp_path_key_t const & key, bgp_path_attr_t const & attr) {
+   attr_ptr interned = attrs_.intern(attr);
+   auto result = paths_.emplace(key, interned);
+   if(!result.second) {
+      if(result.first->second == interned) {
+         return;
+      }
+      result.first->second = interned;
+      change_add(BGP_PATH_UPDATED, key, interned);
+      return;
+   }
+   peer_paths_[key.peer_addr()].insert(key);
+   change_add(BGP_PATH_ADDED, key, interned);
+}
+
+bool
+bgp_path_rib::path_del(bgp_path_key_t const & key) {
+   if(!paths_.erase(key)) {
+      return false;
+   }
+   auto peer = peer_paths_.find(key.peer_addr());
+   peer->second.erase(key);
+   if(peer->second.empty()) {
+      peer_paths_.erase(peer);
+   }
+   change_add(BGP_PATH_DELETED, key, attr_ptr());
+   return true;
+}
+
+void
+bgp_path_rib::change_add(bgp_path_change_type_t type, bgp_path_key_t const & key,
+                         attr_ptr const & attr) {
+   if(changes_.size() == history_) {
+      changes_.pop_front();
+   }
+   changes_.push_back(path_change{++seq_, type, key, attr});
+}
+
+uint64_t
+bgp_path_rib::seq() const {
+   return seq_;
+}
+
+bool
+bgp_path_rib::changes(uint64_t seq, bgp_path_options_t const & options,
+                      size_t max_changes,
+                      std::vector<bgp_path_change_t> & changes) const {
+   if(seq > seq_) {
+      return false;
+   }
+   // Changes are numbered consecutively, so the first one to return is
+   // found by its sequence number.
+   uint64_t first = seq_ - changes_.size();
+   if(seq < first) {
+      return false;
+   }
+   auto it = changes_.begin() + (seq - first);
+   if(max_changes) {
+      changes.reserve(changes.size() +
+                      std::min<size_t>(max_changes, changes_.end() - it));
+   }
+   for(size_t count = 0;
+       it != changes_.end() && (!max_changes || count < max_changes);
+       ++it, ++count) {
+      bgp_path_t path(it->key);
+      if(it->type != BGP_PATH_DELETED) {
+         path = path_project(it->key, *it->attr, options);
+      }
+      changes.push_back(bgp_path_change_t(it->seq, it->type, path));
+   }
+   return true;
+}
+
+size_t
+bgp_path_rib::size() const {
+   return paths_.size();
+}
+
+bgp_path_t
+bgp_path_rib::path(bgp_path_key_t const & key,
+                   bgp_path_options_t const & options) const {
+   auto it = paths_.find(key);
+   if(it == paths_.end()) {
+      return bgp_path_t();
+   }
+   return path_project(it->first, *it->second, options);
+}
+
+template <typename Func>
+void
+bgp_path_rib::candidates_foreach(bgp_path_options_t const & options,
+                                 bgp_path_key_t const * after, Func f) const {
+   if(!options.peer_addrs().empty()) {
+      // Visit the paths of the requested peers only, in peer order.
+      std::vector<ip_addr_t> peers(options.peer_addrs().begin(),
+                                   options.peer_addrs().end());
+      std::sort(peers.begin(), peers.end());
+      for(auto const & peer_addr : peers) {
+         if(after && peer_addr < after->peer_addr()) {
+            continue;
+         }
+         auto peer = peer_paths_.find(peer_addr);
+         if(peer == peer_paths_.end()) {
+            continue;
+         }
+         auto it = peer->second.begin();
+         if(after && peer_addr == after->peer_addr()) {
+            it = peer->second.upper_bound(*after);
+         }
+         for(; it != peer->second.end(); ++it) {
+            if(!f(*paths_.find(*it))) {
+               return;
+            }
+         }
+      }
+      return;
+   }
+   auto start = paths_.begin();
+   if(after) {
+      start = paths_.upper_bound(*after);
+   }
+   if(options.prefixes().empty()) {
+      for(auto it = start; it != paths_.end(); ++it) {
+         if(!f(*it)) {
+            return;
+         }
+      }
+      return;
+   }
+   // Visit the paths within the ranges covered by the requested prefixes.
+   for(auto const & range : prefix_ranges(options.prefixes())) {
+      auto it = paths_.lower_bound(
+            bgp_path_key_t(ip_prefix_t(range.first, 0), ip_addr_t(), ""));
+      if(after && it != paths_.end() && it->first < *after) {
+         it = start;
+      }
+      for(; it != paths_.end() && !(range.last < it->first.prefix().network());
+          ++it) {
+         if(!f(*it)) {
+            return;
+         }
+      }
+   }
+}
+
+std::vector<bgp_path_t>
+bgp_path_rib::paths(bgp_path_options_t & options) const {
+   std::vector<bgp_path_t> result;
+   bgp_path_key_t after;
+   bool resume = !options.page_token().empty();
+   if(resume && !page_token_parse(options.page_token(), &after)) {
+      panic(invalid_argument_error(
+               "page_token", "not a token left by a paged lookup: " +
+               options.page_token()));
+   }
+   uint32_t page_size = options.page_size();
+   bool more = false;
+   candidates_foreach(options, resume ? &after : NULL,
+                      [&](path_map::value_type const & path) {
+      if(!key_match(path.first, options) || !attr_match(*path.second, options)) {
+         return true;
+      }
+      if(page_size && result.size() == page_size) {
+         more = true;
+         return false;
+      }
+      result.push_back(path_project(path.first, *path.second, options));
+      return true;
+   });
+   options.page_token_is(more ? page_token(result.back().path_key()) : "");
+   return result;
+}
+
+}  // namespace eos
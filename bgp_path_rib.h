@@ -0,0 +1,99 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_STUBS_BGP_PATH_RIB_H
+#define EOS_STUBS_BGP_PATH_RIB_H
+
+#include <deque>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "eos/bgp_path.h"
+#include "intern.h"
+
+namespace eos {
+
+/**
+ * The Adj-RIB-In paths of one address family.
+ *
+ * Paths are kept in key order, which is prefix order, and indexed by peer.
+ * A lookup is resolved to the ranges of paths it can match: the paths of
+ * the requested peers, or the key ranges covered by the requested
+ * prefixes. Only these paths are visited, and the filters are evaluated on
+ * the stored attributes: a bgp_path_t is only built for the paths that
+ * match, with just the attributes requested by the options.
+ *
+ * Path attributes are interned: the paths with the same attributes share a
+ * single instance.
+ *
+ * Changes to the paths are numbered and the latest ones are kept, up to a
+ * history size, so that a reader can resume from the last change it saw.
+ */
+class bgp_path_rib {
+ public:
+   explicit bgp_path_rib(size_t history = 65536);
+
+   /// Adds or replaces a path.
+   void path_set(bgp_path_key_t const & key, bgp_path_attr_t const & attr);
+   /// Removes a path, returning false if there was none.
+   bool path_del(bgp_path_key_t const & key);
+   /// Returns the number of paths.
+   size_t size() const;
+
+   /// Returns a path, or an empty bgp_path_t if not found.
+   bgp_path_t path(bgp_path_key_t const & key,
+                   bgp_path_options_t const & options) const;
+   /**
+    * Returns the paths matching the options. Paths are returned in key
+    * order, or in peer then key order if the options are restricted to some
+    * peers. See bgp_path_options_t for paging; a malformed page token
+    * panics with an invalid_argument_error.
+    */
+   std::vector<bgp_path_t> paths(bgp_path_options_t & options) const;
+
+   /// Returns the sequence number of the latest change.
+   uint64_t seq() const;
+   /**
+    * Appends the changes made after the change numbered seq, up to
+    * max_changes of them unless 0. Returns false if some were dropped from
+    * the history.
+    */
+   bool changes(uint64_t seq, bgp_path_options_t const & options,
+                size_t max_changes,
+                std::vector<bgp_path_change_t> & changes) const;
+
+ private:
+   typedef std::shared_ptr<bgp_path_attr_t const> attr_ptr;
+   typedef std::map<bgp_path_key_t, attr_ptr> path_map;
+
+   struct path_change {
+      uint64_t seq;
+      bgp_path_change_type_t type;
+      bgp_path_key_t key;
+      attr_ptr attr;
+   };
+
+   void change_add(bgp_path_change_type_t type, bgp_path_key_t const & key,
+                   attr_ptr const & attr);
+
+   /**
+    * Calls f(path) for each path the options can match, starting after the
+    * given key if not NULL, until f returns false.
+    */
+   template <typename Func>
+   void candidates_foreach(bgp_path_options_t const & options,
+                           bgp_path_key_t const * after, Func f) const;
+
+   intern_table<bgp_path_attr_t> attrs_;
+   path_map paths_;
+   std::map<ip_addr_t, std::set<bgp_path_key_t>> peer_paths_;
+   // The latest changes, numbered consecutively up to seq_.
+   std::deque<path_change> changes_;
+   size_t history_;
+   uint64_t seq_;
+};
+
+}
+
+#endif // EOS_STUBS_BGP_PATH_RIB_H
@@ -1,11 +1,29 @@
 // Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
+#include <map>
+
 #include "eos/class_map.h"
+#include "eos/types/class_map_impl.h"
 #include "impl.h"
+#include "intern.h"
 
 namespace eos {
 
+/// Shares the class map rules stored by the manager.
+class class_map_rule_helper {
+ public:
+   typedef intern_table<class_map_rule_impl_t> rule_table;
+
+   /// Returns a rule equal to the given one, sharing the interned instance.
+   static class_map_rule_t intern(class_map_rule_t const & rule,
+                                  rule_table & rules) {
+      class_map_rule_t interned;
+      interned.pimpl = rules.intern(*rule.pimpl);
+      return interned;
+   }
+};
+
 class class_map_mgr_impl : public class_map_mgr {
  public:
    class_map_mgr_impl() {
@@ -22,10 +40,17 @@ class class_map_mgr_impl : public class_map_mgr {
    }
 
    class_map_t class_map(class_map_key_t const & key) const {
-      return class_map_t();
+      auto it = class_maps_.find(key);
+      return it == class_maps_.end() ? class_map_t() : it->second;
    }
 
    void class_map_is(class_map_t const & class_map) {
+      class_map_t & stored = class_maps_[class_map.key()];
+      stored = class_map;
+      for(auto const & rule : class_map.rules()) {
+         stored.rule_set(rule.first,
+                         class_map_rule_helper::intern(rule.second, rules_));
+      }
    }
 
    class_map_iter_t class_map_iter(policy_feature_t) const {
@@ -34,7 +59,13 @@ class class_map_mgr_impl : public class_map_mgr {
    }
 
    void class_map_del(class_map_key_t const & key) {
+      class_maps_.erase(key);
    }
+
+ private:
+   std::map<class_map_key_t, class_map_t> class_maps_;
+   // The rules of the stored class maps, each stored once.
+   class_map_rule_helper::rule_table rules_;
 };
 
 DEFINE_STUB_MGR_CTOR(class_map_mgr)
@@ -14,18 +14,15 @@ class_map_rule_t::class_map_rule_t(acl_key_t const & acl_key) :
    pimpl(std::make_shared<class_map_rule_impl_t>(
       acl_key
    )) {}
+// Rules are immutable, so copies share the instance.
 EOS_SDK_PUBLIC class_map_rule_t::class_map_rule_t(
    const class_map_rule_t& other) :
-   pimpl(std::make_shared<class_map_rule_impl_t>(
-      *other.pimpl)) {}
+   pimpl(other.pimpl) {}
 EOS_SDK_PUBLIC class_map_rule_t&
 class_map_rule_t::operator=(
    class_map_rule_t const & other)
 {
-   if(this != &other) {
-      pimpl = std::make_shared<class_map_rule_impl_t>(
-         *other.pimpl);
-   }
+   pimpl = other.pimpl;
    return *this;
 }
 
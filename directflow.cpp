@@ -1,7 +1,13 @@
 // Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
+#include <map>
+#include <set>
+#include <unordered_map>
+
 #include "eos/directflow.h"
+#include "eos/directflow_bulk.h"
+#include "eos/timer.h"
 #include "impl.h"
 
 namespace eos {
@@ -17,9 +23,19 @@ flow_handler::flow_handler(directflow_mgr * mgr) :
 
 void
 flow_handler::watch_all_flows(bool should_watch) {
+   if(should_watch) {
+      mgr_->add_handler(this);
+   } else {
+      mgr_->remove_handler(this);
+   }
 }
 
-void flow_handler::watch_flow(std::string const &, bool) {
+void flow_handler::watch_flow(std::string const & name, bool should_watch) {
+   if(should_watch) {
+      mgr_->add_handler(name, this);
+   } else {
+      mgr_->remove_handler(name, this);
+   }
 }
 
 void
@@ -32,7 +48,7 @@ flow_handler::on_flow_status(const std::string & name, flow_status_t status) {
 
 class directflow_mgr_impl : public directflow_mgr {
  public:
-   directflow_mgr_impl() {
+   directflow_mgr_impl() : status_stream_(false) {
    }
 
    flow_entry_iter_t flow_entry_iter() const {
@@ -41,33 +57,132 @@ class directflow_mgr_impl : public directflow_mgr {
    }
 
    bool exists(std::string const & name) const {
-      return false;
+      return flows_.count(name) != 0;
    }
 
    flow_entry_t flow_entry(std::string const & name) const {
-      return flow_entry_t();
+      auto it = flows_.find(name);
+      return it != flows_.end() ? it->second : flow_entry_t();
    }
 
    void flow_entry_set(flow_entry_t const & flow_entry) {
+      flow_entries_set(std::vector<flow_entry_t>(1, flow_entry));
    }
 
    void flow_entry_del(std::string const & name) {
+      flow_entries_del(std::vector<std::string>(1, name));
+   }
+
+   void flow_entries_set(std::vector<flow_entry_t> const & flow_entries) {
+      std::vector<std::string> updated;
+      std::set<std::string> seen;
+      for(auto const & flow_entry : flow_entries) {
+         flows_[flow_entry.name()] = flow_entry;
+         if(seen.insert(flow_entry.name()).second) {
+            updated.push_back(flow_entry.name());
+         }
+      }
+      for(auto const & name : updated) {
+         status_notify(name, FLOW_CREATED);
+      }
+   }
+
+   void flow_entries_del(std::vector<std::string> const & names) {
+      std::vector<std::string> deleted;
+      for(auto const & name : names) {
+         if(flows_.erase(name)) {
+            deleted.push_back(name);
+         }
+      }
+      for(auto const & name : deleted) {
+         status_notify(name, FLOW_DELETED);
+      }
    }
 
    flow_counters_t flow_counters(std::string const & name) const {
       return flow_counters_t();
    }
 
+   void flow_counter_snapshot(flow_counter_snapshot_t & snapshot) const {
+      snapshot.clear();
+      for(auto const & flow : flows_) {
+         snapshot.counter_add(flow.first, flow_counters_t());
+      }
+      snapshot.timestamp_is(now());
+   }
+
+   void flow_status_stream_is(bool enabled) {
+      status_stream_ = enabled;
+      if(!enabled) {
+         status_changes_.clear();
+         status_change_index_.clear();
+      }
+   }
+
+   size_t flow_status_changes(std::vector<flow_status_change_t> & changes) {
+      changes.clear();
+      changes.swap(status_changes_);
+      status_change_index_.clear();
+      return changes.size();
+   }
+
    flow_status_t flow_status(std::string const & name) const {
-      return FLOW_STATUS_UNKNOWN;
+      return exists(name) ? FLOW_CREATED : FLOW_STATUS_UNKNOWN;
    }
 
    flow_rejected_reason_t flow_rejected_reason(std::string const & name) const {
       return FLOW_REJECTED_OTHER;
    }
 
+ private:
+   void status_notify(std::string const & name, flow_status_t status) {
+      if(status_stream_) {
+         flow_status_change_t change(name, status, FLOW_REJECTED_OTHER);
+         auto it = status_change_index_.emplace(name, status_changes_.size());
+         if(it.second) {
+            status_changes_.push_back(change);
+         } else {
+            status_changes_[it.first->second] = change;
+         }
+      }
+      handler_foreach(name, [&](flow_handler * handler) {
+         handler->on_flow_status(name, status);
+      });
+   }
+
+   std::map<std::string, flow_entry_t> flows_;
+   bool status_stream_;
+   std::vector<flow_status_change_t> status_changes_;
+   // The position in status_changes_ of the change queued for each flow.
+   std::unordered_map<std::string, size_t> status_change_index_;
 };
 
+// -- pimpl wrappers to the batch flow and bulk counter functions
+
+void directflow_mgr::flow_entries_set(std::vector<flow_entry_t> const & flows) {
+   static_cast<directflow_mgr_impl *>(this)->flow_entries_set(flows);
+}
+
+void directflow_mgr::flow_entries_del(std::vector<std::string> const & names) {
+   static_cast<directflow_mgr_impl *>(this)->flow_entries_del(names);
+}
+
+void directflow_mgr::flow_counter_snapshot(
+      flow_counter_snapshot_t & snapshot) const {
+   static_cast<directflow_mgr_impl const *>(this)->flow_counter_snapshot(snapshot);
+}
+
+void directflow_mgr::flow_status_stream_is(bool enabled) {
+   static_cast<directflow_mgr_impl *>(this)->flow_status_stream_is(enabled);
+}
+
+size_t directflow_mgr::flow_status_changes(
+      std::vector<flow_status_change_t> & changes) {
+   return static_cast<directflow_mgr_impl *>(this)->flow_status_changes(changes);
+}
+
+// -- end of wrappers
+
 DEFINE_STUB_MGR_CTOR(directflow_mgr)
 
 }
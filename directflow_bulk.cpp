@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include "eos/directflow_bulk.h"
+
+namespace eos {
+
+flow_counter_snapshot_t::flow_counter_snapshot_t() : timestamp_(0) {
+}
+
+void
+flow_counter_snapshot_t::clear() {
+   timestamp_ = 0;
+   names_.clear();
+   bytes_.clear();
+   packets_.clear();
+}
+
+void
+flow_counter_snapshot_t::counter_add(std::string const & name,
+                                     flow_counters_t const & counters) {
+   names_.push_back(name);
+   bytes_.push_back(counters.bytes());
+   packets_.push_back(counters.packets());
+}
+
+seconds_t
+flow_counter_snapshot_t::timestamp() const {
+   return timestamp_;
+}
+
+void
+flow_counter_snapshot_t::timestamp_is(seconds_t timestamp) {
+   timestamp_ = timestamp;
+}
+
+size_t
+flow_counter_snapshot_t::size() const {
+   return names_.size();
+}
+
+std::string const &
+flow_counter_snapshot_t::name(size_t row) const {
+   return names_[row];
+}
+
+uint64_t
+flow_counter_snapshot_t::bytes(size_t row) const {
+   return bytes_[row];
+}
+
+uint64_t
+flow_counter_snapshot_t::packets(size_t row) const {
+   return packets_[row];
+}
+
+uint64_t const *
+flow_counter_snapshot_t::bytes() const {
+   return bytes_.data();
+}
+
+uint64_t const *
+flow_counter_snapshot_t::packets() const {
+   return packets_.data();
+}
+
+}  // namespace eos
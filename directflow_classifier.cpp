@@ -0,0 +1,518 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+
+#include "eos/directflow_classifier.h"
+
+namespace eos {
+
+namespace {
+
+/// The fields a flow can match on.
+enum flow_field_t {
+   FIELD_INPUT_INTF = 0x01,
+   FIELD_ETH_SRC = 0x02,
+   FIELD_ETH_DST = 0x04,
+   FIELD_ETH_TYPE = 0x08,
+   FIELD_VLAN_ID = 0x10,
+   FIELD_COS = 0x20,
+   FIELD_IP_SRC = 0x40,
+   FIELD_IP_DST = 0x80,
+};
+
+/// A 128 bit address, IPv4 addresses are stored in the top 32 bits.
+struct addr128 {
+   uint64_t hi;
+   uint64_t lo;
+
+   bool operator==(addr128 const & other) const {
+      return hi == other.hi && lo == other.lo;
+   }
+   bool operator<(addr128 const & other) const {
+      return std::tie(hi, lo) < std::tie(other.hi, other.lo);
+   }
+   addr128 operator&(addr128 const & other) const {
+      addr128 result = { hi & other.hi, lo & other.lo };
+      return result;
+   }
+};
+
+inline uint64_t load_be64(uint8_t const * bytes) {
+   uint64_t val = 0;
+   for(int i = 0; i < 8; ++i) {
+      val = (val << 8) | bytes[i];
+   }
+   return val;
+}
+
+inline addr128 to_addr128(ip_addr_t const & addr) {
+   addr128 result = { 0, 0 };
+   if(addr.af() == AF_IPV4) {
+      uint8_t const * bytes = addr.addr();
+      result.hi = (uint64_t(bytes[0]) << 56) | (uint64_t(bytes[1]) << 48) |
+                  (uint64_t(bytes[2]) << 40) | (uint64_t(bytes[3]) << 32);
+   } else if(addr.af() == AF_IPV6) {
+      result.hi = load_be64(addr.addr());
+      result.lo = load_be64(addr.addr() + 8);
+   }
+   return result;
+}
+
+/**
+ * Returns the mask to apply to an address, given the mask of a flow. As in
+ * OpenFlow, the zero bits of a mask are wildcards, so an all-zero mask
+ * matches any address of the family.
+ */
+inline addr128 to_mask128(af_t af, ip_addr_t const & mask) {
+   if(mask.af() == AF_NULL) {
+      // An unset mask matches the address exactly.
+      addr128 result = { af == AF_IPV4 ? 0xffffffff00000000ULL : ~uint64_t(0),
+                         af == AF_IPV4 ? 0 : ~uint64_t(0) };
+      return result;
+   }
+   return to_addr128(mask);
+}
+
+inline uint64_t to_uint64(eth_addr_t addr) {
+   uint64_t val = 0;
+   for(int i = 0; i < 6; ++i) {
+      val = (val << 8) | addr.byte(i);
+   }
+   return val;
+}
+
+/// Returns the mask to apply to an Ethernet address, given the mask of a flow.
+inline uint64_t to_mask64(eth_addr_t mask) {
+   uint64_t result = to_uint64(mask);
+   return result ? result : 0xffffffffffffULL;
+}
+
+inline uint64_t mix64(uint64_t x) {
+   x ^= x >> 33;
+   x *= 0xff51afd7ed558ccdULL;
+   x ^= x >> 33;
+   return x;
+}
+
+/// The fields and masks a group of flows matches on.
+struct flow_shape {
+   uint8_t fields;
+   uint64_t eth_src_mask;
+   uint64_t eth_dst_mask;
+   uint16_t vlan_id_mask;
+   addr128 ip_src_mask;
+   addr128 ip_dst_mask;
+
+   bool operator<(flow_shape const & other) const {
+      return std::tie(fields, eth_src_mask, eth_dst_mask, vlan_id_mask,
+                      ip_src_mask, ip_dst_mask) <
+             std::tie(other.fields, other.eth_src_mask, other.eth_dst_mask,
+                      other.vlan_id_mask, other.ip_src_mask, other.ip_dst_mask);
+   }
+};
+
+/// The masked field values a group of flows is hashed on.
+struct flow_key {
+   intf_id_t input_intf;
+   uint64_t eth_src;
+   uint64_t eth_dst;
+   eth_type_t eth_type;
+   vlan_id_t vlan_id;
+   cos_t cos;
+   af_t ip_src_af;
+   af_t ip_dst_af;
+   addr128 ip_src;
+   addr128 ip_dst;
+
+   bool operator==(flow_key const & other) const {
+      return input_intf == other.input_intf && eth_src == other.eth_src &&
+             eth_dst == other.eth_dst && eth_type == other.eth_type &&
+             vlan_id == other.vlan_id && cos == other.cos &&
+             ip_src_af == other.ip_src_af && ip_dst_af == other.ip_dst_af &&
+             ip_src == other.ip_src && ip_dst == other.ip_dst;
+   }
+};
+
+struct flow_key_hash {
+   size_t operator()(flow_key const & key) const {
+      uint64_t h = mix64(key.input_intf.hash() ^ mix64(key.eth_src));
+      h = mix64(h ^ key.eth_dst ^ (uint64_t(key.eth_type) << 48) ^
+                (uint64_t(key.vlan_id) << 32) ^ (uint64_t(key.cos) << 24) ^
+                (uint64_t(key.ip_src_af) << 8) ^ key.ip_dst_af);
+      h = mix64(h ^ key.ip_src.hi ^ mix64(key.ip_src.lo));
+      return mix64(h ^ key.ip_dst.hi ^ mix64(key.ip_dst.lo));
+   }
+};
+
+/// A flow as indexed: its shape, input interfaces and masked values.
+struct flow_spec {
+   flow_shape shape;
+   std::vector<intf_id_t> input_intfs;
+   flow_key value;  // input_intf is unused
+};
+
+flow_spec compile_flow(flow_match_t const & match) {
+   flow_spec spec = {};
+   flow_match_field_set_t fields = match.match_field_set();
+   flow_shape & shape = spec.shape;
+   flow_key & value = spec.value;
+   // An empty set of input interfaces matches on any interface.
+   if(fields.input_intfs() && !match.input_intfs().empty()) {
+      shape.fields |= FIELD_INPUT_INTF;
+      spec.input_intfs.assign(match.input_intfs().begin(),
+                              match.input_intfs().end());
+   }
+   if(fields.eth_src()) {
+      shape.fields |= FIELD_ETH_SRC;
+      shape.eth_src_mask = to_mask64(match.eth_src_mask());
+      value.eth_src = to_uint64(match.eth_src()) & shape.eth_src_mask;
+   }
+   if(fields.eth_dst()) {
+      shape.fields |= FIELD_ETH_DST;
+      shape.eth_dst_mask = to_mask64(match.eth_dst_mask());
+      value.eth_dst = to_uint64(match.eth_dst()) & shape.eth_dst_mask;
+   }
+   if(fields.eth_type()) {
+      shape.fields |= FIELD_ETH_TYPE;
+      value.eth_type = match.eth_type();
+   }
+   if(fields.vlan_id()) {
+      shape.fields |= FIELD_VLAN_ID;
+      shape.vlan_id_mask = match.vlan_id_mask() ? match.vlan_id_mask() : 0xffff;
+      value.vlan_id = match.vlan_id() & shape.vlan_id_mask;
+   }
+   // The class of service is only matched on along with a VLAN.
+   if(fields.cos() && fields.vlan_id() && match.vlan_id()) {
+      shape.fields |= FIELD_COS;
+      value.cos = match.cos();
+   }
+   if(fields.ip_src()) {
+      shape.fields |= FIELD_IP_SRC;
+      value.ip_src_af = match.ip_src().af();
+      shape.ip_src_mask = to_mask128(value.ip_src_af, match.ip_src_mask());
+      value.ip_src = to_addr128(match.ip_src()) & shape.ip_src_mask;
+   }
+   if(fields.ip_dst()) {
+      shape.fields |= FIELD_IP_DST;
+      value.ip_dst_af = match.ip_dst().af();
+      shape.ip_dst_mask = to_mask128(value.ip_dst_af, match.ip_dst_mask());
+      value.ip_dst = to_addr128(match.ip_dst()) & shape.ip_dst_mask;
+   }
+   return spec;
+}
+
+/// Returns the key a packet is looked up with in a group of the given shape.
+flow_key packet_key(flow_packet_t const & packet, flow_shape const & shape) {
+   flow_key key = {};
+   if(shape.fields & FIELD_INPUT_INTF) {
+      key.input_intf = packet.input_intf();
+   }
+   if(shape.fields & FIELD_ETH_SRC) {
+      key.eth_src = to_uint64(packet.eth_src()) & shape.eth_src_mask;
+   }
+   if(shape.fields & FIELD_ETH_DST) {
+      key.eth_dst = to_uint64(packet.eth_dst()) & shape.eth_dst_mask;
+   }
+   if(shape.fields & FIELD_ETH_TYPE) {
+      key.eth_type = packet.eth_type();
+   }
+   if(shape.fields & FIELD_VLAN_ID) {
+      key.vlan_id = packet.vlan_id() & shape.vlan_id_mask;
+   }
+   if(shape.fields & FIELD_COS) {
+      key.cos = packet.cos();
+   }
+   if(shape.fields & FIELD_IP_SRC) {
+      key.ip_src_af = packet.ip_src().af();
+      key.ip_src = to_addr128(packet.ip_src()) & shape.ip_src_mask;
+   }
+   if(shape.fields & FIELD_IP_DST) {
+      key.ip_dst_af = packet.ip_dst().af();
+      key.ip_dst = to_addr128(packet.ip_dst()) & shape.ip_dst_mask;
+   }
+   return key;
+}
+
+/// Returns true if some packet could match both flows.
+bool specs_overlap(flow_spec const & a, flow_spec const & b) {
+   uint8_t common = a.shape.fields & b.shape.fields;
+   if(common & FIELD_INPUT_INTF) {
+      bool found = false;
+      for(auto const & intf : a.input_intfs) {
+         if(std::find(b.input_intfs.begin(), b.input_intfs.end(), intf) !=
+            b.input_intfs.end()) {
+            found = true;
+            break;
+         }
+      }
+      if(!found) {
+         return false;
+      }
+   }
+   if(common & FIELD_ETH_SRC) {
+      uint64_t mask = a.shape.eth_src_mask & b.shape.eth_src_mask;
+      if((a.value.eth_src & mask) != (b.value.eth_src & mask)) {
+         return false;
+      }
+   }
+   if(common & FIELD_ETH_DST) {
+      uint64_t mask = a.shape.eth_dst_mask & b.shape.eth_dst_mask;
+      if((a.value.eth_dst & mask) != (b.value.eth_dst & mask)) {
+         return false;
+      }
+   }
+   if((common & FIELD_ETH_TYPE) && a.value.eth_type != b.value.eth_type) {
+      return false;
+   }
+   if(common & FIELD_VLAN_ID) {
+      uint16_t mask = a.shape.vlan_id_mask & b.shape.vlan_id_mask;
+      if((a.value.vlan_id & mask) != (b.value.vlan_id & mask)) {
+         return false;
+      }
+   }
+   if((common & FIELD_COS) && a.value.cos != b.value.cos) {
+      return false;
+   }
+   if(common & FIELD_IP_SRC) {
+      addr128 mask = a.shape.ip_src_mask & b.shape.ip_src_mask;
+      if(a.value.ip_src_af != b.value.ip_src_af ||
+         !((a.value.ip_src & mask) == (b.value.ip_src & mask))) {
+         return false;
+      }
+   }
+   if(common & FIELD_IP_DST) {
+      addr128 mask = a.shape.ip_dst_mask & b.shape.ip_dst_mask;
+      if(a.value.ip_dst_af != b.value.ip_dst_af ||
+         !((a.value.ip_dst & mask) == (b.value.ip_dst & mask))) {
+         return false;
+      }
+   }
+   return true;
+}
+
+/// A flow in a hash bucket.
+struct flow_ref {
+   flow_priority_t priority;
+   std::string name;
+
+   /// Returns true if this flow wins over the other one.
+   bool operator<(flow_ref const & other) const {
+      return priority != other.priority ? priority > other.priority :
+                                          name < other.name;
+   }
+};
+
+struct flow_tuple;
+
+/// The groups of flows, by the highest priority they hold, highest first.
+typedef std::multimap<flow_priority_t, flow_tuple const *,
+                      std::greater<flow_priority_t>> tuple_order;
+
+/// All the flows matching on the same fields with the same masks.
+struct flow_tuple {
+   flow_tuple() : ordered(false) {
+   }
+
+   flow_shape shape;
+   std::multiset<flow_priority_t> priorities;
+   // The flows of each masked value, best first.
+   std::unordered_map<flow_key, std::vector<flow_ref>, flow_key_hash> flows;
+   // The place of the group in the order, once it has a flow.
+   bool ordered;
+   tuple_order::iterator order_pos;
+};
+
+}  // namespace
+
+class flow_classifier_internal {
+ public:
+   void flow_set(flow_entry_t const & flow) {
+      flow_del(flow.name());
+      flow_spec spec = compile_flow(flow.match());
+      flow_ref ref = { flow.priority(), flow.name() };
+      flow_tuple & tuple = tuples[spec.shape];
+      tuple.shape = spec.shape;
+      tuple.priorities.insert(ref.priority);
+      for_each_key(spec, [&](flow_key const & key) {
+         std::vector<flow_ref> & refs = tuple.flows[key];
+         refs.insert(std::upper_bound(refs.begin(), refs.end(), ref), ref);
+      });
+      flows.emplace(flow.name(), std::make_pair(ref.priority, spec));
+      by_priority[ref.priority].insert(flow.name());
+      order_update(tuple);
+   }
+
+   void flow_del(std::string const & name) {
+      auto it = flows.find(name);
+      if(it == flows.end()) {
+         return;
+      }
+      flow_priority_t priority = it->second.first;
+      flow_spec const & spec = it->second.second;
+      auto tuple = tuples.find(spec.shape);
+      tuple->second.priorities.erase(tuple->second.priorities.find(priority));
+      for_each_key(spec, [&](flow_key const & key) {
+         auto bucket = tuple->second.flows.find(key);
+         if(bucket == tuple->second.flows.end()) {
+            return;
+         }
+         std::vector<flow_ref> & refs = bucket->second;
+         refs.erase(std::remove_if(refs.begin(), refs.end(),
+                                   [&name](flow_ref const & ref) {
+                                      return ref.name == name;
+                                   }),
+                    refs.end());
+         if(refs.empty()) {
+            tuple->second.flows.erase(bucket);
+         }
+      });
+      if(tuple->second.priorities.empty()) {
+         order.erase(tuple->second.order_pos);
+         tuples.erase(tuple);
+      } else {
+         order_update(tuple->second);
+      }
+      auto names = by_priority.find(priority);
+      names->second.erase(name);
+      if(names->second.empty()) {
+         by_priority.erase(names);
+      }
+      flows.erase(it);
+   }
+
+   void flows_clear() {
+      flows.clear();
+      tuples.clear();
+      by_priority.clear();
+      order.clear();
+   }
+
+   flow_ref const * lookup(flow_packet_t const & packet) const {
+      flow_ref const * best = NULL;
+      for(auto const & entry : order) {
+         if(best && best->priority > entry.first) {
+            break;
+         }
+         flow_tuple const * tuple = entry.second;
+         auto it = tuple->flows.find(packet_key(packet, tuple->shape));
+         if(it != tuple->flows.end() && (!best || it->second.front() < *best)) {
+            best = &it->second.front();
+         }
+      }
+      return best;
+   }
+
+   std::vector<std::string> overlaps(flow_entry_t const & flow) const {
+      std::vector<std::string> result;
+      auto names = by_priority.find(flow.priority());
+      if(names == by_priority.end()) {
+         return result;
+      }
+      flow_spec spec = compile_flow(flow.match());
+      for(auto const & name : names->second) {
+         if(name != flow.name() &&
+            specs_overlap(spec, flows.find(name)->second.second)) {
+            result.push_back(name);
+         }
+      }
+      return result;
+   }
+
+   /// Calls f with every key a flow is indexed under.
+   template <typename Func>
+   static void for_each_key(flow_spec const & spec, Func f) {
+      if(!(spec.shape.fields & FIELD_INPUT_INTF)) {
+         f(spec.value);
+         return;
+      }
+      flow_key key = spec.value;
+      for(auto const & intf : spec.input_intfs) {
+         key.input_intf = intf;
+         f(key);
+      }
+   }
+
+   /**
+    * Orders the groups by the highest priority they hold, so that a lookup
+    * can stop as soon as no remaining group can hold a better match. Only
+    * the group a flow was set in or deleted from moves, and only when its
+    * highest priority changed.
+    */
+   void order_update(flow_tuple & tuple) {
+      flow_priority_t highest = *tuple.priorities.rbegin();
+      if(tuple.ordered) {
+         if(tuple.order_pos->first == highest) {
+            return;
+         }
+         order.erase(tuple.order_pos);
+      }
+      tuple.order_pos = order.emplace(highest, &tuple);
+      tuple.ordered = true;
+   }
+
+   std::map<std::string, std::pair<flow_priority_t, flow_spec>> flows;
+   std::map<flow_shape, flow_tuple> tuples;
+   tuple_order order;
+   std::map<flow_priority_t, std::set<std::string>> by_priority;
+};
+
+flow_classifier_t::flow_classifier_t() :
+      classifier_(new flow_classifier_internal()) {
+}
+
+flow_classifier_t::~flow_classifier_t() {
+   delete classifier_;
+}
+
+void
+flow_classifier_t::flow_set(flow_entry_t const & flow) {
+   classifier_->flow_set(flow);
+}
+
+void
+flow_classifier_t::flow_del(std::string const & name) {
+   classifier_->flow_del(name);
+}
+
+void
+flow_classifier_t::flows_clear() {
+   classifier_->flows_clear();
+}
+
+uint32_t
+flow_classifier_t::flow_count() const {
+   return classifier_->flows.size();
+}
+
+std::string
+flow_classifier_t::match(flow_packet_t const & packet) const {
+   flow_ref const * flow = classifier_->lookup(packet);
+   return flow ? flow->name : std::string();
+}
+
+void
+flow_classifier_t::match(std::vector<flow_packet_t> const & packets,
+                         std::vector<std::string> & names) const {
+   names.resize(packets.size());
+   for(size_t i = 0; i < packets.size(); ++i) {
+      flow_ref const * flow = classifier_->lookup(packets[i]);
+      if(flow) {
+         names[i] = flow->name;
+      } else {
+         names[i].clear();
+      }
+   }
+}
+
+std::vector<std::string>
+flow_classifier_t::overlaps(flow_entry_t const & flow) const {
+   return classifier_->overlaps(flow);
+}
+
+}  // namespace eos
@@ -0,0 +1,430 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <deque>
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "eos/eapi_client.h"
+#include "eos/eapi_json.h"
+#include "eos/fd.h"
+
+namespace eos {
+
+namespace {
+
+void json_escape(std::string & out, std::string const & s) {
+   static char const hex[] = "0123456789abcdef";
+   out += '"';
+   for(unsigned char c : s) {
+      if(c == '"' || c == '\\') {
+         out += '\\';
+         out += c;
+      } else if(c < 0x20) {
+         out += "\\u00";
+         out += hex[c >> 4];
+         out += hex[c & 0xf];
+      } else {
+         out += c;
+      }
+   }
+   out += '"';
+}
+
+/**
+ * Converts a JSON-RPC reply of eAPI into a response, dropping the outputs
+ * of the first `skip` commands.
+ */
+eapi_response_t eapi_response(std::string const & body, uint32_t skip) {
+   json_view_t reply(body);
+   if(reply.type() != JSON_OBJECT) {
+      return eapi_response_t(false, 0, "Malformed eAPI response", {});
+   }
+   bool success = false;
+   uint32_t error_code = 0;
+   std::string error_message;
+   json_view_t outputs = reply.get("result");
+   if(!!outputs) {
+      success = true;
+   } else {
+      json_view_t error = reply.get("error");
+      error_code = error.get("code").to_int64();
+      error_message = error.get("message").to_string();
+      // The outputs of the commands run before the failing one.
+      outputs = error.get("data");
+   }
+   std::vector<std::string> responses;
+   for(auto const & output : outputs.elements()) {
+      if(skip) {
+         --skip;
+         continue;
+      }
+      responses.push_back(output.raw());
+   }
+   return eapi_response_t(success, error_code, error_message, responses);
+}
+
+/**
+ * Walks the chunks of a body sent with "Transfer-Encoding: chunked",
+ * starting at `pos`, appending their data to `body` if not NULL. Returns
+ * the position after the last chunk and the trailer, or std::string::npos
+ * if the body is not complete yet.
+ */
+size_t chunked_body(std::string const & in, size_t pos, std::string * body) {
+   for(;;) {
+      size_t line_end = in.find("\r\n", pos);
+      if(line_end == std::string::npos) {
+         return std::string::npos;
+      }
+      // Chunk extensions after the size are ignored.
+      size_t size = strtoul(in.c_str() + pos, NULL, 16);
+      pos = line_end + 2;
+      if(!size) {
+         // Skip the trailer fields, up to the empty line.
+         for(;;) {
+            line_end = in.find("\r\n", pos);
+            if(line_end == std::string::npos) {
+               return std::string::npos;
+            }
+            if(line_end == pos) {
+               return pos + 2;
+            }
+            pos = line_end + 2;
+         }
+      }
+      if(in.size() < pos + size + 2) {
+         return std::string::npos;
+      }
+      if(body) {
+         body->append(in, pos, size);
+      }
+      pos += size + 2;
+   }
+}
+
+/**
+ * Returns the position of the value of the header line starting at `line`,
+ * or std::string::npos if it is not the given header.
+ */
+size_t header_value(std::string const & in, size_t line, char const * header) {
+   size_t len = strlen(header);
+   return strncasecmp(in.c_str() + line, header, len) ? std::string::npos
+                                                      : line + len;
+}
+
+}  // namespace
+
+class eapi_client_internal : public fd_handler {
+ public:
+   eapi_client_internal(eapi_client_t * client, std::string const & socket_path) :
+         client(client), socket_path(socket_path), fd(-1), out_pos(0),
+         next_id(1), connection(0) {
+      event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+      watch_readable(event_fd, true);
+   }
+
+   ~eapi_client_internal() {
+      disconnect();
+      watch_readable(event_fd, false);
+      close(event_fd);
+   }
+
+   /**
+    * Sends commands, the first `skip` of which only enter the right mode:
+    * their outputs are not part of the response.
+    */
+   uint64_t request(std::vector<std::string> const & cmds, uint32_t skip,
+                    char const * format) {
+      uint64_t id = next_id++;
+      std::string body = "{\"jsonrpc\": \"2.0\", \"method\": \"runCmds\", "
+                         "\"params\": {\"version\": 1, \"cmds\": [";
+      for(size_t i = 0; i < cmds.size(); ++i) {
+         if(i) {
+            body += ", ";
+         }
+         json_escape(body, cmds[i]);
+      }
+      body += "], \"format\": \"";
+      body += format;
+      body += "\"}, \"id\": \"" + std::to_string(id) + "\"}";
+
+      if(fd < 0 && !connect()) {
+         failed.push_back(std::make_pair(id, "Cannot connect to " + socket_path));
+         failed_notify();
+         return id;
+      }
+      out += "POST /command-api HTTP/1.1\r\n"
+             "Host: localhost\r\n"
+             "Content-Type: application/json\r\n"
+             "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n";
+      out += body;
+      in_flight.push_back(std::make_pair(id, skip));
+      flush();
+      return id;
+   }
+
+   void on_readable(int readable_fd) {
+      if(readable_fd == event_fd) {
+         uint64_t count;
+         (void)!read(event_fd, &count, sizeof(count));
+         std::deque<std::pair<uint64_t, std::string>> requests;
+         requests.swap(failed);
+         for(auto const & request : requests) {
+            client->on_eapi_response(request.first, eapi_response_t(
+                  false, 0, request.second, {}));
+         }
+         return;
+      }
+      char buf[65536];
+      for(;;) {
+         ssize_t len = read(fd, buf, sizeof(buf));
+         if(len > 0) {
+            in.append(buf, len);
+            continue;
+         }
+         if(len < 0 && (errno == EAGAIN || errno == EINTR)) {
+            break;
+         }
+         // The server closed the connection, ending a response without a
+         // length if any.
+         responses_process(true);
+         if(readable_fd == fd) {
+            disconnect_fail(write_error.empty() ? "eAPI connection closed"
+                                                : write_error);
+         }
+         return;
+      }
+      responses_process(false);
+   }
+
+   void on_writable(int) {
+      flush();
+   }
+
+   eapi_client_t * client;
+   std::string socket_path;
+   int fd;
+   int event_fd;
+   std::string out;
+   size_t out_pos;
+   std::string in;
+   uint64_t next_id;
+   // The requests sent and not answered yet, in the order sent, with the
+   // number of responses to skip.
+   std::deque<std::pair<uint64_t, uint32_t>> in_flight;
+   // Counts the connections made, to notice a disconnection from a callback.
+   uint64_t connection;
+   // The requests that failed, with the reason, to complete from the event
+   // loop.
+   std::deque<std::pair<uint64_t, std::string>> failed;
+   // Why the connection can no longer be written to, if it can't.
+   std::string write_error;
+
+ private:
+   bool connect() {
+      fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+      if(fd < 0) {
+         return false;
+      }
+      struct sockaddr_un addr;
+      memset(&addr, 0, sizeof(addr));
+      addr.sun_family = AF_UNIX;
+      strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+      if(::connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+         close(fd);
+         fd = -1;
+         return false;
+      }
+      watch_readable(fd, true);
+      ++connection;
+      return true;
+   }
+
+   void disconnect() {
+      if(fd < 0) {
+         return;
+      }
+      watch_readable(fd, false);
+      watch_writable(fd, false);
+      close(fd);
+      fd = -1;
+      out.clear();
+      out_pos = 0;
+      in.clear();
+      write_error.clear();
+   }
+
+   /// Wakes up the event loop to complete the failed requests.
+   void failed_notify() {
+      uint64_t one = 1;
+      (void)!write(event_fd, &one, sizeof(one));
+   }
+
+   /**
+    * Drops the connection, failing the requests in flight. They complete
+    * from the event loop, so that a request never completes from within the
+    * call that made it.
+    */
+   void disconnect_fail(std::string message) {
+      disconnect();
+      for(auto const & request : in_flight) {
+         failed.push_back(std::make_pair(request.first, message));
+      }
+      in_flight.clear();
+      failed_notify();
+   }
+
+   /**
+    * Writes the pending requests. Once a write fails, the requests in flight
+    * fail when the server closes the connection, after the responses it
+    * sent before are delivered.
+    */
+   void flush() {
+      if(!write_error.empty()) {
+         out.clear();
+         out_pos = 0;
+         return;
+      }
+      while(out_pos < out.size()) {
+         // MSG_NOSIGNAL: a connection closed by the server fails with EPIPE
+         // rather than killing the agent with SIGPIPE.
+         ssize_t len = send(fd, out.data() + out_pos, out.size() - out_pos,
+                            MSG_NOSIGNAL);
+         if(len < 0) {
+            if(errno == EINTR) {
+               continue;
+            }
+            if(errno == EAGAIN) {
+               watch_writable(fd, true);
+               return;
+            }
+            write_error = std::string("eAPI write failed: ") + strerror(errno);
+            out.clear();
+            out_pos = 0;
+            watch_writable(fd, false);
+            return;
+         }
+         out_pos += len;
+      }
+      out.clear();
+      out_pos = 0;
+      watch_writable(fd, false);
+   }
+
+   /**
+    * Delivers the complete HTTP responses received. Bodies are framed by
+    * their Content-Length or chunked transfer encoding; if eof is set, a
+    * response with neither ends with the data received.
+    */
+   void responses_process(bool eof) {
+      uint64_t current = connection;
+      size_t pos = 0;
+      while(!in_flight.empty()) {
+         size_t headers_end = in.find("\r\n\r\n", pos);
+         if(headers_end == std::string::npos) {
+            break;
+         }
+         int status = 0;
+         size_t space = in.find(' ', pos);
+         if(space < headers_end) {
+            status = atoi(in.c_str() + space + 1);
+         }
+         size_t body_begin = headers_end + 4;
+         size_t length = eof ? in.size() - body_begin : std::string::npos;
+         bool chunked = false;
+         for(size_t line = in.find("\r\n", pos); line < headers_end;
+             line = in.find("\r\n", line + 2)) {
+            size_t value = header_value(in, line + 2, "Content-Length:");
+            if(value != std::string::npos) {
+               length = strtoul(in.c_str() + value, NULL, 10);
+               continue;
+            }
+            value = header_value(in, line + 2, "Transfer-Encoding:");
+            if(value != std::string::npos) {
+               std::string coding = in.substr(value, in.find("\r\n", value) - value);
+               for(auto & c : coding) {
+                  c = tolower(c);
+               }
+               chunked = coding.find("chunked") != std::string::npos;
+            }
+         }
+         std::string body;
+         if(chunked) {
+            // Only decode the body once it is complete.
+            size_t body_end = chunked_body(in, body_begin, NULL);
+            if(body_end == std::string::npos) {
+               break;
+            }
+            chunked_body(in, body_begin, &body);
+            pos = body_end;
+         } else {
+            if(length == std::string::npos || in.size() - body_begin < length) {
+               break;
+            }
+            body = in.substr(body_begin, length);
+            pos = body_begin + length;
+         }
+
+         uint64_t id = in_flight.front().first;
+         uint32_t skip = in_flight.front().second;
+         in_flight.pop_front();
+         eapi_response_t response = eapi_response(body, skip);
+         if(status != 200 && !response.success() && !response.error_code()) {
+            response = eapi_response_t(false, status, "HTTP status " +
+                                       std::to_string(status), {});
+         }
+         client->on_eapi_response(id, response);
+         if(fd < 0 || connection != current) {
+            return;  // disconnected by the callback
+         }
+      }
+      in.erase(0, pos);
+   }
+};
+
+eapi_client_t::eapi_client_t(std::string const & socket_path) :
+      client_(new eapi_client_internal(this, socket_path)) {
+}
+
+eapi_client_t::~eapi_client_t() {
+   delete client_;
+}
+
+uint64_t
+eapi_client_t::run_show_cmd(std::string const & cmd) {
+   return client_->request(std::vector<std::string>{"enable", cmd}, 1, "json");
+}
+
+uint64_t
+eapi_client_t::run_show_cmd_text(std::string const & cmd) {
+   return client_->request(std::vector<std::string>{"enable", cmd}, 1, "text");
+}
+
+uint64_t
+eapi_client_t::run_config_cmds(std::vector<std::string> const & cmds) {
+   std::vector<std::string> all;
+   all.reserve(cmds.size() + 2);
+   all.push_back("enable");
+   all.push_back("configure");
+   all.insert(all.end(), cmds.begin(), cmds.end());
+   return client_->request(all, 2, "json");
+}
+
+size_t
+eapi_client_t::pending_requests() const {
+   return client_->in_flight.size() + client_->failed.size();
+}
+
+void
+eapi_client_t::on_eapi_response(uint64_t id, eapi_response_t const & response) {
+}
+
+}  // namespace eos
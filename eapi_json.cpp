@@ -0,0 +1,475 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "eos/eapi_json.h"
+
+namespace eos {
+
+namespace {
+
+inline bool is_space(char c) {
+   return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+inline char const * skip_space(char const * p, char const * end) {
+   while(p < end && is_space(*p)) {
+      ++p;
+   }
+   return p;
+}
+
+/// Returns the end of the string starting at p, or NULL if unterminated.
+char const * skip_string(char const * p, char const * end) {
+   for(++p; p < end;) {
+      char const * quote = (char const *)memchr(p, '"', end - p);
+      if(!quote) {
+         return NULL;
+      }
+      // The quote is escaped if preceded by an odd number of backslashes.
+      char const * q = quote;
+      while(q > p && q[-1] == '\\') {
+         --q;
+      }
+      if((quote - q) % 2 == 0) {
+         return quote + 1;
+      }
+      p = quote + 1;
+   }
+   return NULL;
+}
+
+/// The characters that matter when skipping over an array or object.
+struct structural_table {
+   structural_table() {
+      memset(is_structural, 0, sizeof(is_structural));
+      for(unsigned char c : std::string("\"{}[]")) {
+         is_structural[c] = true;
+      }
+   }
+   bool is_structural[256];
+};
+
+static structural_table const structural;
+
+/// Returns the end of the value starting at p, or NULL if malformed.
+char const * skip_value(char const * p, char const * end) {
+   if(p >= end) {
+      return NULL;
+   }
+   switch(*p) {
+    case '"':
+      return skip_string(p, end);
+    case '{':
+    case '[': {
+      int depth = 0;
+      while(p < end) {
+         while(p < end && !structural.is_structural[(unsigned char)*p]) {
+            ++p;
+         }
+         if(p == end) {
+            return NULL;
+         }
+         if(*p == '"') {
+            p = skip_string(p, end);
+            if(!p) {
+               return NULL;
+            }
+            continue;
+         }
+         if(*p == '{' || *p == '[') {
+            ++depth;
+         } else if(--depth == 0) {
+            return p + 1;
+         }
+         ++p;
+      }
+      return NULL;
+    }
+    default:
+      while(p < end && *p != ',' && *p != '}' && *p != ']' && !is_space(*p)) {
+         ++p;
+      }
+      return p;
+   }
+}
+
+void utf8_append(std::string & out, uint32_t cp) {
+   if(cp < 0x80) {
+      out += char(cp);
+   } else if(cp < 0x800) {
+      out += char(0xc0 | (cp >> 6));
+      out += char(0x80 | (cp & 0x3f));
+   } else if(cp < 0x10000) {
+      out += char(0xe0 | (cp >> 12));
+      out += char(0x80 | ((cp >> 6) & 0x3f));
+      out += char(0x80 | (cp & 0x3f));
+   } else {
+      out += char(0xf0 | (cp >> 18));
+      out += char(0x80 | ((cp >> 12) & 0x3f));
+      out += char(0x80 | ((cp >> 6) & 0x3f));
+      out += char(0x80 | (cp & 0x3f));
+   }
+}
+
+uint32_t hex4(char const * p, char const * end) {
+   if(end - p < 4) {
+      return 0xfffd;
+   }
+   char buf[5] = { p[0], p[1], p[2], p[3], 0 };
+   return strtoul(buf, NULL, 16);
+}
+
+/// Unescapes the contents of the string [begin, end), quotes excluded.
+std::string unescape(char const * begin, char const * end) {
+   std::string result;
+   result.reserve(end - begin);
+   for(char const * p = begin; p < end; ++p) {
+      if(*p != '\\' || p + 1 == end) {
+         result += *p;
+         continue;
+      }
+      switch(*++p) {
+       case 'n': result += '\n'; break;
+       case 't': result += '\t'; break;
+       case 'r': result += '\r'; break;
+       case 'b': result += '\b'; break;
+       case 'f': result += '\f'; break;
+       case 'u': {
+         uint32_t cp = hex4(p + 1, end);
+         p += 4;
+         if(cp >= 0xd800 && cp < 0xdc00 && end - p > 6 && p[1] == '\\' &&
+            p[2] == 'u') {
+            uint32_t low = hex4(p + 3, end);
+            if(low >= 0xdc00 && low < 0xe000) {
+               cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+               p += 6;
+            }
+         }
+         utf8_append(result, cp);
+         break;
+       }
+       default: result += *p; break;  // '"', '\\' and '/'
+      }
+   }
+   return result;
+}
+
+/// Returns true if the string [begin, end), quotes included, equals str.
+bool string_equal(char const * begin, char const * end, std::string const & str) {
+   char const * contents = begin + 1;
+   size_t len = end - begin - 2;
+   if(!memchr(contents, '\\', len)) {
+      return len == str.size() && !memcmp(contents, str.data(), len);
+   }
+   return unescape(contents, end - 1) == str;
+}
+
+/**
+ * Calls f(key_begin, key_end, value) for each member of the object
+ * [begin, end), the key quotes included, until f returns false.
+ */
+template <typename Func>
+void object_foreach(char const * begin, char const * end, Func f) {
+   char const * p = skip_space(begin + 1, end);
+   while(p < end && *p == '"') {
+      char const * key_end = skip_string(p, end);
+      if(!key_end) {
+         return;
+      }
+      char const * colon = skip_space(key_end, end);
+      if(colon >= end || *colon != ':') {
+         return;
+      }
+      char const * value = skip_space(colon + 1, end);
+      char const * value_end = skip_value(value, end);
+      if(!value_end) {
+         return;
+      }
+      if(!f(p, key_end, json_view_t(value, value_end - value))) {
+         return;
+      }
+      p = skip_space(value_end, end);
+      if(p < end && *p == ',') {
+         p = skip_space(p + 1, end);
+      }
+   }
+}
+
+/// Calls f(element) for each element of the array [begin, end), until f
+/// returns false.
+template <typename Func>
+void array_foreach(char const * begin, char const * end, Func f) {
+   char const * p = skip_space(begin + 1, end);
+   while(p < end && *p != ']') {
+      char const * value_end = skip_value(p, end);
+      if(!value_end) {
+         return;
+      }
+      if(!f(json_view_t(p, value_end - p))) {
+         return;
+      }
+      p = skip_space(value_end, end);
+      if(p < end && *p == ',') {
+         p = skip_space(p + 1, end);
+      }
+   }
+}
+
+void query_walk(json_view_t const & value,
+                std::vector<std::string> const & path, size_t depth,
+                std::vector<std::string> & keys,
+                std::vector<json_match_t> & matches) {
+   if(depth == path.size()) {
+      matches.push_back(json_match_t(keys, value));
+      return;
+   }
+   std::string const & component = path[depth];
+   bool wildcard = component == "*";
+   if(value.type() == JSON_OBJECT) {
+      object_foreach(value.data(), value.data() + value.size(),
+                     [&](char const * key, char const * key_end,
+                         json_view_t const & member) {
+         if(wildcard) {
+            keys.push_back(unescape(key + 1, key_end - 1));
+            query_walk(member, path, depth + 1, keys, matches);
+            keys.pop_back();
+            return true;
+         }
+         if(string_equal(key, key_end, component)) {
+            query_walk(member, path, depth + 1, keys, matches);
+         }
+         return true;
+      });
+   } else if(value.type() == JSON_ARRAY) {
+      char * index_end;
+      size_t wanted = strtoul(component.c_str(), &index_end, 10);
+      if(!wildcard && (component.empty() || *index_end)) {
+         return;
+      }
+      size_t index = 0;
+      array_foreach(value.data(), value.data() + value.size(),
+                    [&](json_view_t const & element) {
+         if(wildcard) {
+            keys.push_back(std::to_string(index));
+            query_walk(element, path, depth + 1, keys, matches);
+            keys.pop_back();
+         } else if(index == wanted) {
+            query_walk(element, path, depth + 1, keys, matches);
+            return false;
+         }
+         ++index;
+         return true;
+      });
+   }
+}
+
+}  // namespace
+
+json_view_t::json_view_t() : begin_(NULL), end_(NULL) {
+}
+
+json_view_t::json_view_t(std::string const & json) : begin_(NULL), end_(NULL) {
+   char const * end = json.data() + json.size();
+   char const * p = skip_space(json.data(), end);
+   char const * value_end = skip_value(p, end);
+   if(value_end) {
+      begin_ = p;
+      end_ = value_end;
+   }
+}
+
+json_view_t::json_view_t(char const * data, size_t size) :
+      begin_(data), end_(data + size) {
+}
+
+json_type_t
+json_view_t::type() const {
+   if(begin_ == end_) {
+      return JSON_NONE;
+   }
+   switch(*begin_) {
+    case '{': return JSON_OBJECT;
+    case '[': return JSON_ARRAY;
+    case '"': return JSON_STRING;
+    case 't':
+    case 'f': return JSON_BOOL;
+    case 'n': return JSON_NULL;
+    default: return JSON_NUMBER;
+   }
+}
+
+bool
+json_view_t::operator!() const {
+   return begin_ == end_;
+}
+
+char const *
+json_view_t::data() const {
+   return begin_;
+}
+
+size_t
+json_view_t::size() const {
+   return end_ - begin_;
+}
+
+std::string
+json_view_t::raw() const {
+   return std::string(begin_, end_);
+}
+
+bool
+json_view_t::to_bool() const {
+   return type() == JSON_BOOL && *begin_ == 't';
+}
+
+int64_t
+json_view_t::to_int64() const {
+   if(type() != JSON_NUMBER) {
+      return 0;
+   }
+   // Numbers are converted from a copy, as the text may not be terminated.
+   std::string number(begin_, end_);
+   if(number.find_first_of(".eE") != std::string::npos) {
+      return int64_t(strtod(number.c_str(), NULL));
+   }
+   return strtoll(number.c_str(), NULL, 10);
+}
+
+double
+json_view_t::to_double() const {
+   if(type() != JSON_NUMBER) {
+      return 0;
+   }
+   std::string number(begin_, end_);
+   return strtod(number.c_str(), NULL);
+}
+
+std::string
+json_view_t::to_string() const {
+   if(type() != JSON_STRING) {
+      return raw();
+   }
+   return unescape(begin_ + 1, end_ - 1);
+}
+
+bool
+json_view_t::string_equals(std::string const & str) const {
+   return type() == JSON_STRING && string_equal(begin_, end_, str);
+}
+
+json_view_t
+json_view_t::get(std::string const & key) const {
+   json_view_t result;
+   if(type() == JSON_OBJECT) {
+      object_foreach(begin_, end_, [&](char const * key_begin,
+                                      char const * key_end,
+                                      json_view_t const & value) {
+         if(string_equal(key_begin, key_end, key)) {
+            result = value;
+            return false;
+         }
+         return true;
+      });
+   }
+   return result;
+}
+
+json_view_t
+json_view_t::at(size_t index) const {
+   json_view_t result;
+   if(type() == JSON_ARRAY) {
+      array_foreach(begin_, end_, [&](json_view_t const & element) {
+         if(!index--) {
+            result = element;
+            return false;
+         }
+         return true;
+      });
+   }
+   return result;
+}
+
+size_t
+json_view_t::count() const {
+   size_t count = 0;
+   if(type() == JSON_OBJECT) {
+      object_foreach(begin_, end_, [&](char const *, char const *,
+                                      json_view_t const &) {
+         ++count;
+         return true;
+      });
+   } else if(type() == JSON_ARRAY) {
+      array_foreach(begin_, end_, [&](json_view_t const &) {
+         ++count;
+         return true;
+      });
+   }
+   return count;
+}
+
+std::vector<std::pair<std::string, json_view_t>>
+json_view_t::members() const {
+   std::vector<std::pair<std::string, json_view_t>> result;
+   if(type() == JSON_OBJECT) {
+      object_foreach(begin_, end_, [&](char const * key, char const * key_end,
+                                      json_view_t const & value) {
+         result.push_back(std::make_pair(unescape(key + 1, key_end - 1), value));
+         return true;
+      });
+   }
+   return result;
+}
+
+std::vector<json_view_t>
+json_view_t::elements() const {
+   std::vector<json_view_t> result;
+   if(type() == JSON_ARRAY) {
+      array_foreach(begin_, end_, [&](json_view_t const & element) {
+         result.push_back(element);
+         return true;
+      });
+   }
+   return result;
+}
+
+std::vector<json_match_t>
+json_view_t::query(std::string const & path) const {
+   std::vector<std::string> components;
+   for(size_t pos = 0; pos < path.size();) {
+      size_t slash = path.find('/', pos);
+      if(slash == std::string::npos) {
+         slash = path.size();
+      }
+      components.push_back(path.substr(pos, slash - pos));
+      pos = slash + 1;
+   }
+   std::vector<std::string> keys;
+   std::vector<json_match_t> matches;
+   if(!!*this) {
+      query_walk(*this, components, 0, keys, matches);
+   }
+   return matches;
+}
+
+json_match_t::json_match_t() {
+}
+
+json_match_t::json_match_t(std::vector<std::string> const & keys,
+                           json_view_t value) : keys_(keys), value_(value) {
+}
+
+std::vector<std::string> const &
+json_match_t::keys() const {
+   return keys_;
+}
+
+json_view_t
+json_match_t::value() const {
+   return value_;
+}
+
+}  // namespace eos
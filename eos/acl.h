@@ -57,6 +57,7 @@
 #define EOS_ACL_H
 
 #include <utility>
+#include <vector>
 
 #include <eos/base.h>
 #include <eos/base_handler.h>
@@ -117,6 +118,19 @@ class EOS_SDK_PUBLIC acl_handler : public base_handler<acl_mgr, acl_handler> {
     */
    virtual void on_acl_sync_fail(std::string const & linecard,
                                  std::string const & message);
+
+   /**
+    * Called from within acl_commit(), once for every ACL whose staged
+    * changes it pushed, after all of the committed ACLs have been pushed.
+    *
+    * Unlike on_acl_sync(), this is called synchronously and only reports
+    * that the configuration was updated, not that it was loaded into
+    * hardware.
+    *
+    * @param acl_key_t The ACL committed
+    * @param uint32_t The number of rules set or removed by the commit
+    */
+   virtual void on_acl_commit(acl_key_t const &, uint32_t);
 };
 
 class acl_iter_impl;
@@ -264,6 +278,37 @@ class EOS_SDK_PUBLIC acl_mgr : public base_mgr<acl_handler> {
     */
    virtual void acl_commit() = 0;
 
+   /**
+    * Commits the rule changes made to the given ACLs only.
+    *
+    * Only the rules whose sequence numbers were set or removed since the
+    * ACL was last committed are pushed, so changing one rule of a large
+    * ACL does not push the whole ACL again. The changes to all of the
+    * given ACLs are pushed together, as a single transaction: no
+    * intermediate state where only some of them are committed is ever
+    * visible. ACLs without pending changes are skipped. As with
+    * acl_commit(), on_acl_commit() is called for each ACL pushed, and
+    * on_acl_sync() or on_acl_sync_fail() once hardware is updated. Unlike
+    * acl_commit(), if none of the ACLs has pending changes nothing is
+    * pushed, and no handler is called.
+    */
+   void acl_commit(std::vector<acl_key_t> const &);
+
+   /**
+    * Discards the rule changes made to the ACL since it was last committed.
+    *
+    * If the ACL key doesn't exist, that is a no op.
+    */
+   void acl_discard(acl_key_t const &);
+
+   /**
+    * Returns the number of rules of the ACL with changes pending commit.
+    *
+    * Setting a rule to the value it was last committed with does not count
+    * as a change.
+    */
+   uint32_t acl_pending_rule_count(acl_key_t const &) const;
+
    /**
     * Deletes the ACL.
     *
@@ -307,7 +352,7 @@ class EOS_SDK_PUBLIC acl_mgr : public base_mgr<acl_handler> {
     *
     * @param ip_addr_t Source IP address
     * @param ip_addr_t Destination IP address
-    * @param uint8_t Protocol (optional)
+    * @param uint8_t Protocol (optional, TCP if 0)
     * @param uint16_t Source port (optional)
     * @param uint16_t Destination port (optional)
     * @return false if connection should be dropped, true otherwise.
@@ -0,0 +1,147 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_ACL_CLASSIFIER_H
+#define EOS_ACL_CLASSIFIER_H
+
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/ip.h>
+#include <eos/types/acl.h>
+
+/**
+ * @file
+ * Software classification of packets against IP ACLs.
+ *
+ * An acl_classifier_t compiles the rules of an IPv4 or IPv6 ACL into a
+ * decision structure, so that packets can be matched against thousands
+ * of rules without evaluating them one by one. This is what backs
+ * acl_mgr::stream_allowed() and acl_mgr::dgram_allowed(), and it can
+ * be used directly by agents that classify traffic in software, e.g. a
+ * control-plane proxy checking every new connection.
+ *
+ * Rules are grouped by the pair of source and destination prefix
+ * lengths they match on ("tuple space search"): each group is a hash
+ * table keyed by the masked addresses, so a lookup costs one hash probe
+ * per distinct pair of prefix lengths in the ACL. Port specifications
+ * are matched through their acl_port_range_set_t.
+ *
+ * @code
+ *    eos::acl_classifier_t classifier;
+ *    classifier.rule_set(10, rule);
+ *    classifier.commit();
+ *    eos::acl_packet_t packet(src, dst, 6, 33000, 443);
+ *    if (classifier.classify(packet) == eos::ACL_DENY) {
+ *       // drop the connection
+ *    }
+ * @endcode
+ *
+ * Only the fields carried by an acl_packet_t are considered. Rules that
+ * also match on fields a packet tuple cannot describe (VLANs, nexthop
+ * group, ICMP type or code, fragments) never match.
+ */
+
+namespace eos {
+
+/// The header fields of an IP packet classified by an acl_classifier_t.
+class EOS_SDK_PUBLIC acl_packet_t {
+ public:
+   acl_packet_t();
+   acl_packet_t(ip_addr_t const & source_addr, ip_addr_t const & destination_addr,
+                uint8_t ip_protocol, uint16_t source_port,
+                uint16_t destination_port);
+
+   ip_addr_t source_addr() const;
+   void source_addr_is(ip_addr_t const & source_addr);
+   ip_addr_t destination_addr() const;
+   void destination_addr_is(ip_addr_t const & destination_addr);
+   uint8_t ip_protocol() const;
+   void ip_protocol_is(uint8_t ip_protocol);
+   uint16_t source_port() const;
+   void source_port_is(uint16_t source_port);
+   uint16_t destination_port() const;
+   void destination_port_is(uint16_t destination_port);
+   /// Getter for 'ttl': the time to live (IPv4) or hop limit (IPv6).
+   uint8_t ttl() const;
+   void ttl_is(uint8_t ttl);
+   /// Getter for 'tos': the type of service (IPv4) or traffic class (IPv6).
+   uint8_t tos() const;
+   void tos_is(uint8_t tos);
+   /// Getter for 'tcp_flags': a bitmask of acl_tcp_flag_t.
+   uint16_t tcp_flags() const;
+   void tcp_flags_is(uint16_t tcp_flags);
+
+ private:
+   ip_addr_t source_addr_;
+   ip_addr_t destination_addr_;
+   uint8_t ip_protocol_;
+   uint16_t source_port_;
+   uint16_t destination_port_;
+   uint8_t ttl_;
+   uint8_t tos_;
+   uint16_t tcp_flags_;
+};
+
+class acl_classifier_internal;
+
+/**
+ * A compiled IP ACL.
+ *
+ * Rule changes are staged by rule_set() and rule_del(), and only take
+ * effect for classification once commit() has applied them to the
+ * decision structure, much like acl_mgr::acl_commit(). Only the rules
+ * that changed are recompiled, so updating one rule of a large ACL is
+ * cheap.
+ */
+class EOS_SDK_PUBLIC acl_classifier_t {
+ public:
+   acl_classifier_t();
+   ~acl_classifier_t();
+
+   /// Stages the rule at the given sequence number, replacing any existing one.
+   void rule_set(uint32_t seq, acl_rule_ip_t const & rule);
+   /// Stages the removal of the rule at the given sequence number.
+   void rule_del(uint32_t seq);
+   /// Stages the removal of all rules.
+   void rules_clear();
+   /// Applies the staged changes; classification uses them from now on.
+   void commit();
+   /// Discards the changes staged since the last commit.
+   void rollback();
+
+   /// Returns the number of rules in the committed ACL.
+   uint32_t rule_count() const;
+   /**
+    * Returns the number of sequence numbers with staged changes. Setting a
+    * rule back to its committed value is not a change.
+    */
+   uint32_t pending_count() const;
+
+   /**
+    * Returns the sequence number of the first committed rule matching the
+    * packet, or 0 if no rule matches.
+    */
+   uint32_t match(acl_packet_t const & packet) const;
+   /**
+    * Returns the action of the first committed rule matching the packet, or
+    * ACL_DENY if no rule matches (the implicit deny at the end of an ACL).
+    */
+   acl_action_t classify(acl_packet_t const & packet) const;
+   /// Classifies a batch of packets, filling actions[i] for packets[i].
+   void classify(std::vector<acl_packet_t> const & packets,
+                 std::vector<acl_action_t> & actions) const;
+   /// Matches a batch of packets, filling seqs[i] for packets[i].
+   void match(std::vector<acl_packet_t> const & packets,
+              std::vector<uint32_t> & seqs) const;
+
+ private:
+   acl_classifier_internal * classifier_;
+   EOS_SDK_DISALLOW_COPY_CTOR(acl_classifier_t);
+};
+
+}
+
+#include <eos/inline/acl_classifier.h>
+
+#endif // EOS_ACL_CLASSIFIER_H
@@ -17,6 +17,8 @@
  *  - BFD global interval timers setter/getter
  *  - BFD interface timers setter/getter
  *  - BFD session status getter
+ *  - Batched BFD session creation and deletion, and bulk status snapshots
+ *    (see eos/bfd_bulk.h)
  *  
  *  An iterator is also provided to iterate through all BFD sessions that are
  *  configured via EosSdk in the system.
@@ -26,6 +28,8 @@
 #ifndef EOS_BFD_H
 #define EOS_BFD_H
 
+#include <vector>
+
 #include <eos/base_handler.h>
 #include <eos/base_mgr.h>
 #include <eos/intf.h>
@@ -38,6 +42,7 @@
 namespace eos {
 
 class bfd_session_mgr;
+class bfd_session_status_snapshot_t;
 
 /**
  *  The BFD handler.
@@ -256,6 +261,38 @@ class EOS_SDK_PUBLIC bfd_session_mgr :
     */
    virtual bfd_session_status_t session_status(bfd_session_key_t const &) const = 0;
 
+   /**
+    * Creates a batch of BFD sessions.
+    *
+    * Equivalent to calling session_set() for each key, except that the
+    * sessions are committed together: handlers are notified once all of
+    * them exist, with a single on_bfd_session_set() per new session.
+    */
+   void sessions_set(std::vector<bfd_session_key_t> const &);
+
+   /// Removes a batch of BFD sessions, notifying handlers once all are removed.
+   void sessions_del(std::vector<bfd_session_key_t> const &);
+
+   /**
+    * Reads the status of all BFD sessions configured through EosSdk into a
+    * snapshot.
+    *
+    * The snapshot is cleared first, then filled with one row per session
+    * and stamped with the current time. Reusing the same snapshot between
+    * calls avoids reallocating its columns.
+    */
+   void session_status_snapshot(bfd_session_status_snapshot_t &) const;
+
+   /**
+    * Reads the status of the given BFD sessions into a snapshot.
+    *
+    * Row i of the snapshot holds the status of the i-th key, so that an
+    * agent can check the liveness of the sessions it manages in one call.
+    * Sessions that are not configured have BFD_SESSION_STATUS_NULL.
+    */
+   void session_status_snapshot(std::vector<bfd_session_key_t> const &,
+                                bfd_session_status_snapshot_t &) const;
+
    /**
     * sBFD echo sessions.
     *
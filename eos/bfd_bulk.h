@@ -0,0 +1,75 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_BFD_BULK_H
+#define EOS_BFD_BULK_H
+
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/bfd.h>
+
+/**
+ * @file
+ * Bulk BFD session status.
+ *
+ * A bfd_session_status_snapshot_t holds the status of many BFD sessions at
+ * one point in time, as returned by bfd_session_mgr::session_status_snapshot(),
+ * with one row per session and the statuses in a contiguous column. The
+ * statuses can be read by row, or the whole column at a time.
+ *
+ * Together with bfd_session_mgr::sessions_set() and sessions_del(), this
+ * lets an agent provision thousands of sessions and check their liveness
+ * in a handful of calls, rather than one call per session.
+ *
+ * @code
+ *    std::vector<eos::bfd_session_key_t> keys = tunnel_keys();
+ *    bfd_session_mgr->sessions_set(keys);
+ *
+ *    eos::bfd_session_status_snapshot_t snapshot;
+ *    bfd_session_mgr->session_status_snapshot(keys, snapshot);
+ *    for (size_t row = 0; row < snapshot.size(); ++row) {
+ *       if (snapshot.status(row) != eos::BFD_SESSION_STATUS_UP) {
+ *          failover(keys[row]);
+ *       }
+ *    }
+ * @endcode
+ */
+
+namespace eos {
+
+/// The status of a set of BFD sessions at one point in time.
+class EOS_SDK_PUBLIC bfd_session_status_snapshot_t {
+ public:
+   bfd_session_status_snapshot_t();
+
+   /// Removes all rows, keeping the allocated columns for reuse.
+   void clear();
+   /// Appends a row for a session.
+   void status_add(bfd_session_key_t const & key, bfd_session_status_t status);
+
+   /// The time at which the statuses were read, as returned by eos::now().
+   seconds_t timestamp() const;
+   void timestamp_is(seconds_t timestamp);
+
+   /// The number of rows in the snapshot.
+   size_t size() const;
+   /// The key of the session of a row.
+   bfd_session_key_t const & key(size_t row) const;
+
+   /// The status of the session of a row.
+   bfd_session_status_t status(size_t row) const;
+   /// The status of the session of every row.
+   bfd_session_status_t const * statuses() const;
+   /// Returns the number of rows with the given status.
+   size_t status_count(bfd_session_status_t status) const;
+
+ private:
+   seconds_t timestamp_;
+   std::vector<bfd_session_key_t> keys_;
+   std::vector<bfd_session_status_t> statuses_;
+};
+
+}
+
+#endif // EOS_BFD_BULK_H
@@ -18,6 +18,8 @@
 #ifndef EOS_BGP_PATH_H
 #define EOS_BGP_PATH_H
 
+#include <vector>
+
 #include <eos/base_handler.h>
 #include <eos/base_mgr.h>
 #include <eos/types/bgp_path.h>
@@ -80,6 +82,24 @@ class EOS_SDK_PUBLIC bgp_path_handler : public base_handler<bgp_path_mgr,
     */
    virtual void on_ipv6_unicast_bgp_converged(bool converged);
 
+   /**
+    * Handler called with a batch of changes to IPv4 unicast paths in
+    * Adj-RIB-In, in sequence order. The paths carry their next hop and
+    * community list. Called after on_ipv4_unicast_path() was called for
+    * each path of the batch.
+    */
+   virtual void on_ipv4_unicast_path_changes(
+         std::vector<bgp_path_change_t> const & changes);
+
+   /**
+    * Handler called with a batch of changes to IPv6 unicast paths in
+    * Adj-RIB-In, in sequence order. The paths carry their next hop and
+    * community list. Called after on_ipv6_unicast_path() was called for
+    * each path of the batch.
+    */
+   virtual void on_ipv6_unicast_path_changes(
+         std::vector<bgp_path_change_t> const & changes);
+
 };
 
 /**
@@ -93,10 +113,25 @@ class EOS_SDK_PUBLIC bgp_path_mgr: public base_mgr<bgp_path_handler,
    /**
     * Returns an iterator over IPv4 Unicast BGP paths in Adj-RIB-In, which
     * contains unprocessed routing information that has been advertised to the
-    * local BGP speaker by its peers.
+    * local BGP speaker by its peers. Only the paths matching the prefix,
+    * peer, community and next hop filters of the options are yielded.
     */
    virtual bgp_path_iter_t ipv4_unicast_path_iter(bgp_path_options_t &) const = 0;
 
+   /**
+    * Returns a page of the IPv4 Unicast BGP paths in Adj-RIB-In matching the
+    * filters of the options. At most page_size() paths are returned,
+    * resuming after the path where the page_token() of the options left
+    * off; the page token is then updated to resume after the last path
+    * returned, or cleared if no matching path remains. Panics with an
+    * invalid_argument_error if the page token was not left by a lookup.
+    *
+    * Filters are evaluated before the paths are built, and a filter on
+    * peers or prefixes only visits the paths it can match, so the cost of
+    * a lookup is proportional to the number of paths it returns.
+    */
+   std::vector<bgp_path_t> ipv4_unicast_paths(bgp_path_options_t &) const;
+
    /**
     * Returns an IPv4 Unicast BGP path in Adj-RIB-In with the corresponding
     * path key. Returns an empty bgp_path_t if no matching path was found.
@@ -111,13 +146,47 @@ class EOS_SDK_PUBLIC bgp_path_mgr: public base_mgr<bgp_path_handler,
     */
    virtual bool ipv4_unicast_bgp_convergence() = 0;
 
+   /// Returns the sequence number of the latest change to IPv4 Unicast paths.
+   uint64_t ipv4_unicast_path_seq() const;
+
+   /**
+    * Appends to `changes` the changes to IPv4 Unicast paths made after the
+    * change numbered `seq`, oldest first and at most max_changes of them,
+    * or all of them if max_changes is 0. The paths carry the attributes
+    * requested by the path_attr_fields() of the options; other options
+    * are ignored.
+    *
+    * Only the recent changes are retained. Returns false if some changes
+    * made after `seq` are no longer available: the paths must then be read
+    * again, with ipv4_unicast_paths(), after noting ipv4_unicast_path_seq()
+    * to resume the changes from.
+    */
+   bool ipv4_unicast_path_changes(
+         uint64_t seq, bgp_path_options_t const & options, size_t max_changes,
+         std::vector<bgp_path_change_t> & changes) const;
+
    /**
     * Returns an iterator over IPv6 Unicast BGP paths in Adj-RIB-In, which
     * contains unprocessed routing information that has been advertised to the
-    * local BGP speaker by its peers.
+    * local BGP speaker by its peers. Only the paths matching the prefix,
+    * peer, community and next hop filters of the options are yielded.
     */
    virtual bgp_path_iter_t ipv6_unicast_path_iter(bgp_path_options_t &) const = 0;
 
+   /**
+    * Returns a page of the IPv6 Unicast BGP paths in Adj-RIB-In matching the
+    * filters of the options. At most page_size() paths are returned,
+    * resuming after the path where the page_token() of the options left
+    * off; the page token is then updated to resume after the last path
+    * returned, or cleared if no matching path remains. Panics with an
+    * invalid_argument_error if the page token was not left by a lookup.
+    *
+    * Filters are evaluated before the paths are built, and a filter on
+    * peers or prefixes only visits the paths it can match, so the cost of
+    * a lookup is proportional to the number of paths it returns.
+    */
+   std::vector<bgp_path_t> ipv6_unicast_paths(bgp_path_options_t &) const;
+
    /**
     * Returns an IPv6 Unicast BGP path in Adj-RIB-In with the corresponding
     * path key. Returns an empty bgp_path_t if no matching path was found.
@@ -132,6 +201,25 @@ class EOS_SDK_PUBLIC bgp_path_mgr: public base_mgr<bgp_path_handler,
     */
    virtual bool ipv6_unicast_bgp_convergence() = 0;
 
+   /// Returns the sequence number of the latest change to IPv6 Unicast paths.
+   uint64_t ipv6_unicast_path_seq() const;
+
+   /**
+    * Appends to `changes` the changes to IPv6 Unicast paths made after the
+    * change numbered `seq`, oldest first and at most max_changes of them,
+    * or all of them if max_changes is 0. The paths carry the attributes
+    * requested by the path_attr_fields() of the options; other options
+    * are ignored.
+    *
+    * Only the recent changes are retained. Returns false if some changes
+    * made after `seq` are no longer available: the paths must then be read
+    * again, with ipv6_unicast_paths(), after noting ipv6_unicast_path_seq()
+    * to resume the changes from.
+    */
+   bool ipv6_unicast_path_changes(
+         uint64_t seq, bgp_path_options_t const & options, size_t max_changes,
+         std::vector<bgp_path_change_t> & changes) const;
+
 
   protected:
    bgp_path_mgr() EOS_SDK_PRIVATE;
@@ -18,6 +18,7 @@
 #define EOS_DIRECTFLOW_H
 
 #include <set>
+#include <vector>
 
 #include <eos/base.h>
 #include <eos/base_handler.h>
@@ -29,6 +30,8 @@ namespace eos {
 
 
 class directflow_mgr;
+class flow_counter_snapshot_t;
+class flow_status_change_t;
 
 /**
  * Flow handler.
@@ -94,6 +97,17 @@ class EOS_SDK_PUBLIC directflow_mgr : public base_mgr<flow_handler, std::string>
    /// Delete a flow
    virtual void flow_entry_del(std::string const &) = 0;
 
+   /**
+    * Insert or update a batch of flows.
+    *
+    * Equivalent to calling flow_entry_set() for each flow, except that
+    * handlers are notified once all of the flows are updated, with a
+    * single on_flow_status() per flow.
+    */
+   void flow_entries_set(std::vector<flow_entry_t> const &);
+   /// Delete a batch of flows, notifying handlers once all are deleted.
+   void flow_entries_del(std::vector<std::string> const &);
+
    /// Return the status of the given flow
    virtual flow_status_t flow_status(std::string const & name) const = 0;
    /**
@@ -105,6 +119,32 @@ class EOS_SDK_PUBLIC directflow_mgr : public base_mgr<flow_handler, std::string>
    /// Return the counters for a flow
    virtual flow_counters_t flow_counters(std::string const & name) const = 0;
 
+   /**
+    * Reads the counters of all flows into a snapshot.
+    *
+    * The snapshot is cleared first, then filled with one row per flow and
+    * stamped with the current time. Reusing the same snapshot between
+    * calls avoids reallocating its columns.
+    */
+   void flow_counter_snapshot(flow_counter_snapshot_t &) const;
+
+   /**
+    * Enables or disables queueing of flow status changes.
+    *
+    * While enabled, every change of the status of a flow is queued, to be
+    * read with flow_status_changes(). Disabling it drops the queue.
+    */
+   void flow_status_stream_is(bool enabled);
+   /**
+    * Moves the queued flow status changes into the given vector, replacing
+    * its contents, and returns how many there were.
+    *
+    * Changes are ordered as they happened. A flow whose status changed
+    * several times since the last call appears once, at the position of
+    * its first change, with its latest status.
+    */
+   size_t flow_status_changes(std::vector<flow_status_change_t> &);
+
  protected:
    directflow_mgr() EOS_SDK_PRIVATE;
    friend class flow_handler;
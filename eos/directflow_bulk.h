@@ -0,0 +1,107 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_DIRECTFLOW_BULK_H
+#define EOS_DIRECTFLOW_BULK_H
+
+#include <string>
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/directflow.h>
+
+/**
+ * @file
+ * Bulk DirectFlow counters and status changes.
+ *
+ * A flow_counter_snapshot_t holds the counters of every flow at one point
+ * in time, as returned by directflow_mgr::flow_counter_snapshot(), with
+ * one row per flow and the bytes and packets in contiguous columns. The
+ * counters can be read by row, or a whole column at a time.
+ *
+ * Flow status changes can also be streamed: once enabled with
+ * directflow_mgr::flow_status_stream_is(), status changes are queued
+ * and directflow_mgr::flow_status_changes() drains them in one call,
+ * rather than querying the status of each flow by name.
+ *
+ * @code
+ *    eos::flow_counter_snapshot_t snapshot;
+ *    directflow_mgr->flow_counter_snapshot(snapshot);
+ *    for (size_t row = 0; row < snapshot.size(); ++row) {
+ *       export(snapshot.name(row), snapshot.bytes(row),
+ *              snapshot.packets(row));
+ *    }
+ *
+ *    std::vector<eos::flow_status_change_t> changes;
+ *    directflow_mgr->flow_status_changes(changes);
+ *    for (auto const & change : changes) {
+ *       if (change.status() == eos::FLOW_REJECTED) {
+ *          failover(change.name());
+ *       }
+ *    }
+ * @endcode
+ */
+
+namespace eos {
+
+/// The counters of all flows at one point in time.
+class EOS_SDK_PUBLIC flow_counter_snapshot_t {
+ public:
+   flow_counter_snapshot_t();
+
+   /// Removes all rows, keeping the allocated columns for reuse.
+   void clear();
+   /// Appends a row for a flow.
+   void counter_add(std::string const & name, flow_counters_t const & counters);
+
+   /// The time at which the counters were read, as returned by eos::now().
+   seconds_t timestamp() const;
+   void timestamp_is(seconds_t timestamp);
+
+   /// The number of rows in the snapshot.
+   size_t size() const;
+   /// The name of the flow of a row.
+   std::string const & name(size_t row) const;
+
+   /// The bytes matched by the flow of a row.
+   uint64_t bytes(size_t row) const;
+   /// The packets matched by the flow of a row.
+   uint64_t packets(size_t row) const;
+
+   /// The bytes matched by the flow of every row.
+   uint64_t const * bytes() const;
+   /// The packets matched by the flow of every row.
+   uint64_t const * packets() const;
+
+ private:
+   seconds_t timestamp_;
+   std::vector<std::string> names_;
+   std::vector<uint64_t> bytes_;
+   std::vector<uint64_t> packets_;
+};
+
+/// A change of the status of a flow.
+class EOS_SDK_PUBLIC flow_status_change_t {
+ public:
+   flow_status_change_t();
+   flow_status_change_t(std::string const & name, flow_status_t status,
+                        flow_rejected_reason_t rejected_reason);
+
+   /// The name of the flow.
+   std::string const & name() const;
+   /// The new status of the flow.
+   flow_status_t status() const;
+   /// The reason the flow was rejected. Only valid if status is FLOW_REJECTED.
+   flow_rejected_reason_t rejected_reason() const;
+
+ private:
+   std::string name_;
+   flow_status_t status_;
+   flow_rejected_reason_t rejected_reason_;
+};
+
+}
+
+#include <eos/inline/directflow_bulk.h>
+
+#endif // EOS_DIRECTFLOW_BULK_H
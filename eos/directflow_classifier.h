@@ -0,0 +1,141 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_DIRECTFLOW_CLASSIFIER_H
+#define EOS_DIRECTFLOW_CLASSIFIER_H
+
+#include <string>
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/eth.h>
+#include <eos/intf.h>
+#include <eos/ip.h>
+#include <eos/types/directflow.h>
+
+/**
+ * @file
+ * Software classification of packets against DirectFlow flows.
+ *
+ * A flow_classifier_t indexes a set of flow entries so that packets can
+ * be matched against them the way the switch would: the flow with the
+ * highest priority whose match covers the packet wins. Controllers can
+ * use it to simulate forwarding through a flow table, or to check a new
+ * flow for overlaps with existing ones before programming it.
+ *
+ * Flows are grouped by the set of fields and masks they match on
+ * ("tuple space search"); each group is a hash table keyed by the masked
+ * field values, and groups are probed from the highest priority they
+ * hold downwards, so a lookup stops as soon as no remaining group can
+ * beat the best match found.
+ *
+ * @code
+ *    eos::flow_classifier_t classifier;
+ *    for (auto const & flow : flows) {
+ *       classifier.flow_set(flow);
+ *    }
+ *    eos::flow_packet_t packet;
+ *    packet.input_intf_is(eos::intf_id_t("Ethernet1"));
+ *    packet.ip_dst_is(eos::ip_addr_t("10.0.0.1"));
+ *    std::string name = classifier.match(packet);
+ * @endcode
+ *
+ * A flow matching on input interfaces matches packets received on any
+ * of them; an empty set of input interfaces matches any interface. The
+ * class of service is only matched on by flows matching a non-zero VLAN
+ * ID, as documented by flow_match_t::cos(). Among flows of equal priority,
+ * the one with the smallest name wins.
+ *
+ * IP address masks follow OpenFlow: the zero bits of a mask are
+ * wildcards, so an all-zero mask such as 0.0.0.0 matches any address of
+ * the family, and an unset mask (an ip_addr_t of family AF_NULL) matches
+ * the address exactly. Ethernet address and VLAN ID masks cannot be left
+ * unset, so for them an all-zero mask, the default, means exact match
+ * rather than wildcard: to match any value, do not match on the field.
+ */
+
+namespace eos {
+
+/// The header fields of a packet classified by a flow_classifier_t.
+class EOS_SDK_PUBLIC flow_packet_t {
+ public:
+   flow_packet_t();
+
+   intf_id_t input_intf() const;
+   void input_intf_is(intf_id_t input_intf);
+   eth_addr_t eth_src() const;
+   void eth_src_is(eth_addr_t eth_src);
+   eth_addr_t eth_dst() const;
+   void eth_dst_is(eth_addr_t eth_dst);
+   eth_type_t eth_type() const;
+   void eth_type_is(eth_type_t eth_type);
+   vlan_id_t vlan_id() const;
+   void vlan_id_is(vlan_id_t vlan_id);
+   cos_t cos() const;
+   void cos_is(cos_t cos);
+   ip_addr_t ip_src() const;
+   void ip_src_is(ip_addr_t const & ip_src);
+   ip_addr_t ip_dst() const;
+   void ip_dst_is(ip_addr_t const & ip_dst);
+
+ private:
+   intf_id_t input_intf_;
+   eth_addr_t eth_src_;
+   eth_addr_t eth_dst_;
+   eth_type_t eth_type_;
+   vlan_id_t vlan_id_;
+   cos_t cos_;
+   ip_addr_t ip_src_;
+   ip_addr_t ip_dst_;
+};
+
+class flow_classifier_internal;
+
+/**
+ * An index of flow entries.
+ *
+ * Changes take effect immediately: flows are added to and removed from
+ * the index one by one, so keeping a classifier in sync with a large
+ * flow table is cheap.
+ */
+class EOS_SDK_PUBLIC flow_classifier_t {
+ public:
+   flow_classifier_t();
+   ~flow_classifier_t();
+
+   /// Adds a flow, replacing any existing flow with the same name.
+   void flow_set(flow_entry_t const & flow);
+   /// Removes the flow with the given name, if any.
+   void flow_del(std::string const & name);
+   /// Removes all flows.
+   void flows_clear();
+
+   /// Returns the number of flows in the index.
+   uint32_t flow_count() const;
+
+   /**
+    * Returns the name of the flow matching the packet, or the empty string
+    * if no flow matches.
+    */
+   std::string match(flow_packet_t const & packet) const;
+   /// Matches a batch of packets, filling names[i] for packets[i].
+   void match(std::vector<flow_packet_t> const & packets,
+              std::vector<std::string> & names) const;
+
+   /**
+    * Returns the names of the flows with the same priority as the given
+    * flow that some packet could match along with it, i.e. whose relative
+    * order is ambiguous. The given flow itself, found by name, is ignored.
+    */
+   std::vector<std::string> overlaps(flow_entry_t const & flow) const;
+
+ private:
+   flow_classifier_internal * classifier_;
+   EOS_SDK_DISALLOW_COPY_CTOR(flow_classifier_t);
+};
+
+}
+
+#include <eos/inline/directflow_classifier.h>
+
+#endif // EOS_DIRECTFLOW_CLASSIFIER_H
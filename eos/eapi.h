@@ -15,6 +15,7 @@
  * for which EOS SDK APIs do not yet exist.
  * Note that each method is a synchronous call, and opens a unix-domain socket.
  * Therefore, this is not intended to be a replacement for other EosSdk modules.
+ * To send many commands without blocking the agent, see eos/eapi_client.h.
  *
  * For more information about eAPI, please visit
  * https://eos.arista.com/arista-eapi-101/
@@ -0,0 +1,81 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_EAPI_CLIENT_H
+#define EOS_EAPI_CLIENT_H
+
+#include <string>
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/types/eapi.h>
+
+/**
+ * @file
+ * Asynchronous eAPI client.
+ *
+ * The eapi_mgr runs each command synchronously, blocking the agent for
+ * the whole round trip to the Cli server. An eapi_client_t instead sends
+ * requests without waiting for the previous ones to complete, over a
+ * single persistent connection to the eAPI unix-domain socket, and
+ * delivers each response from the event loop by calling
+ * on_eapi_response() with the id returned when the request was made.
+ * Responses are delivered in the order the requests were made.
+ *
+ * @code
+ *    class my_client : public eos::eapi_client_t {
+ *     public:
+ *       void on_eapi_response(uint64_t id, eos::eapi_response_t const & resp) {
+ *          if (resp.success()) {
+ *             // resp.responses()[0] holds the JSON output of the command.
+ *          }
+ *       }
+ *    };
+ *
+ *    my_client client;
+ *    uint64_t id = client.run_show_cmd("show interfaces");
+ * @endcode
+ *
+ * Responses may be sent with a Content-Length or chunked transfer encoding.
+ * If the connection fails, the requests in flight complete with an
+ * unsuccessful response, and the next request opens a new connection.
+ * Failed requests also complete from the event loop, never from within
+ * the call that made them.
+ */
+
+namespace eos {
+
+class eapi_client_internal;
+
+/// A pipelining eAPI client.
+class EOS_SDK_PUBLIC eapi_client_t {
+ public:
+   /// Creates a client of the eAPI server listening on the given socket.
+   explicit eapi_client_t(
+         std::string const & socket_path = "/var/run/command-api.sock");
+   virtual ~eapi_client_t();
+
+   /// Sends a "show" CLI command, run in enable mode. Returns the request id.
+   uint64_t run_show_cmd(std::string const &);
+   /// Like run_show_cmd(), but for "text" formatted output.
+   uint64_t run_show_cmd_text(std::string const &);
+   /// Sends CLI commands, run in configuration mode. Returns the request id.
+   uint64_t run_config_cmds(std::vector<std::string> const &);
+
+   /// Returns the number of requests sent and not yet responded to.
+   size_t pending_requests() const;
+
+   /**
+    * Called from the event loop when a request completes. A request that
+    * could not be sent or answered completes with success() false.
+    */
+   virtual void on_eapi_response(uint64_t id, eapi_response_t const & response);
+
+ private:
+   eapi_client_internal * client_;
+   EOS_SDK_DISALLOW_COPY_CTOR(eapi_client_t);
+};
+
+}
+
+#endif // EOS_EAPI_CLIENT_H
@@ -0,0 +1,138 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_EAPI_JSON_H
+#define EOS_EAPI_JSON_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <eos/base.h>
+
+/**
+ * @file
+ * Views over the JSON output of eAPI commands.
+ *
+ * The responses of an eapi_response_t are the JSON text of each command's
+ * output. A json_view_t reads such text in place: it designates one JSON
+ * value within the text, and moving to a member or an element scans past
+ * the values in between without building a document tree or copying
+ * them. Only the values actually read are converted.
+ *
+ * Path queries select values by a list of keys separated by '/', where '*'
+ * matches every member of an object or every element of an array. For each
+ * value found, the keys matched by wildcards are returned along with it.
+ *
+ * @code
+ *    eos::eapi_response_t resp = eapiMgr->run_show_cmd("show interfaces");
+ *    eos::json_view_t root(resp.responses()[0]);
+ *    for (auto const & match : root.get("interfaces").query("*")) {
+ *       // match.keys()[0] is the interface name.
+ *       if (!match.value().get("lineProtocolStatus").string_equals("up")) {
+ *          // ...
+ *       }
+ *    }
+ * @endcode
+ *
+ * Views do not own the text they designate: the text must outlive them,
+ * which is why a view can't be made of a temporary string. For the same
+ * reason, views can't be made from Python.
+ */
+
+namespace eos {
+
+/// The type of a JSON value.
+enum json_type_t {
+   /// No value: a missing member or element, or malformed JSON.
+   JSON_NONE,
+   JSON_NULL,
+   JSON_BOOL,
+   JSON_NUMBER,
+   JSON_STRING,
+   JSON_ARRAY,
+   JSON_OBJECT,
+};
+
+class json_match_t;
+
+/// A JSON value within a JSON text.
+class EOS_SDK_PUBLIC json_view_t {
+ public:
+   /// Creates an empty view, of type JSON_NONE.
+   json_view_t();
+   /// Creates a view of the JSON value held by the given string.
+   explicit json_view_t(std::string const & json);
+   /// A view of a temporary string would outlive its text.
+   explicit json_view_t(std::string && json) = delete;
+   /// Creates a view of the JSON value held by the given buffer.
+   json_view_t(char const * data, size_t size);
+
+   /// The type of the value.
+   json_type_t type() const;
+   /// Returns true if there is no value.
+   bool operator!() const;
+
+   /// The JSON text of the value.
+   char const * data() const;
+   /// The length of the JSON text of the value.
+   size_t size() const;
+   /// Returns a copy of the JSON text of the value.
+   std::string raw() const;
+
+   /// Returns the value of a boolean, or false if this isn't a boolean.
+   bool to_bool() const;
+   /// Returns the value of a number as an integer, or 0 if this isn't a number.
+   int64_t to_int64() const;
+   /// Returns the value of a number, or 0 if this isn't a number.
+   double to_double() const;
+   /**
+    * Returns the contents of a string, unescaped, or the JSON text of the
+    * value if this isn't a string.
+    */
+   std::string to_string() const;
+   /// Returns true if this is a string equal to the given one, once unescaped.
+   bool string_equals(std::string const & str) const;
+
+   /// Returns the member of an object with the given key, or an empty view.
+   json_view_t get(std::string const & key) const;
+   /// Returns the element of an array at the given index, or an empty view.
+   json_view_t at(size_t index) const;
+   /// Returns the number of members of an object or elements of an array.
+   size_t count() const;
+   /// Returns the members of an object, in order.
+   std::vector<std::pair<std::string, json_view_t>> members() const;
+   /// Returns the elements of an array, in order.
+   std::vector<json_view_t> elements() const;
+
+   /**
+    * Returns the values matching a path, in document order. A path is a
+    * list of object keys or array indexes separated by '/'; '*' matches any
+    * key or index. The empty path matches this value.
+    */
+   std::vector<json_match_t> query(std::string const & path) const;
+
+ private:
+   char const * begin_;
+   char const * end_;
+};
+
+/// A value found by json_view_t::query().
+class EOS_SDK_PUBLIC json_match_t {
+ public:
+   json_match_t();
+   json_match_t(std::vector<std::string> const & keys, json_view_t value);
+
+   /// The keys, or array indexes, matched by the wildcards of the path.
+   std::vector<std::string> const & keys() const;
+   /// The value found.
+   json_view_t value() const;
+
+ private:
+   std::vector<std::string> keys_;
+   json_view_t value_;
+};
+
+}
+
+#endif // EOS_EAPI_JSON_H
@@ -18,6 +18,7 @@
 #define EOS_FIB_H
 
 #include <forward_list>
+#include <vector>
 #include <eos/types/sdk.h>
 #include <eos/intf.h>
 #include <eos/ip.h>
@@ -85,6 +86,18 @@ class EOS_SDK_PUBLIC fib_mgr : public base_mgr<fib_handler> {
    virtual fib_route_iter_t fib_route_iter() const = 0;
    virtual fib_fec_iter_t fib_fec_iter() const = 0;
 
+   /**
+    * Returns the keys of the routes currently resolving via the given FEC.
+    *
+    * The manager keeps a reverse index from each FEC to the routes that
+    * point at it, so this only visits the dependent routes instead of
+    * walking the whole route table. This is typically used from
+    * fib_handler::on_fec_set() to find the routes impacted by a FEC change.
+    */
+   std::vector<fib_route_key_t> routes_using_fec(fib_fec_key_t const &) const;
+   /// Returns the number of routes currently resolving via the given FEC.
+   uint32_t fec_ref_count(fib_fec_key_t const &) const;
+
    // FEC management
    virtual bool fib_fec_set(fib_fec_t const &) = 0;
    virtual void fib_fec_del(fib_fec_key_t const &) = 0;
@@ -97,6 +110,15 @@ class EOS_SDK_PUBLIC fib_mgr : public base_mgr<fib_handler> {
    virtual bool fib_route_exists(fib_route_key_t const &) = 0;
    virtual fib_route_t fib_route(fib_route_key_t const &) = 0;
 
+   /**
+    * Writes the current routes and FECs to a snapshot file.
+    *
+    * The snapshot is written in the columnar format described in
+    * eos/fib_snapshot.h and can be read, from any process, with a
+    * fib_snapshot_reader. Returns false if the file could not be written.
+    */
+   bool fib_snapshot_write(std::string const & path) const;
+
    // VRF Management
    virtual bool register_vrf(std::string const &, bool) = 0;
 
@@ -0,0 +1,134 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_FIB_SNAPSHOT_H
+#define EOS_FIB_SNAPSHOT_H
+
+#include <string>
+
+#include <eos/base.h>
+#include <eos/types/fib.h>
+
+/**
+ * @file
+ * FIB snapshot export.
+ *
+ * This module writes the contents of the FIB (routes, FECs and their
+ * vias) into a versioned, columnar binary file, and provides a reader
+ * that maps such a file into memory so it can be queried without
+ * parsing or copying it, typically from another process doing offline
+ * analysis.
+ *
+ * Each attribute is stored as a contiguous, 8-byte aligned array
+ * ("column") indexed by route, FEC or via position; strings such as
+ * interface and nexthop group names live in a shared string table.
+ * FECs are stored sorted by FEC id, so the FEC of a route can be found
+ * with a binary search. Values are stored in host byte order, so a
+ * snapshot is meant to be read on a machine of the same architecture.
+ *
+ * @code
+ *    // In the agent:
+ *    fib_mgr->fib_snapshot_write("/tmp/fib.snap");
+ *
+ *    // In the analysis tool:
+ *    eos::fib_snapshot_reader snap("/tmp/fib.snap");
+ *    if (snap.valid()) {
+ *       for (uint64_t i = 0; i < snap.route_count(); ++i) {
+ *          eos::fib_route_t route = snap.route(i);
+ *          eos::fib_fec_t fec = snap.fec(snap.fec_index(route.fec_id()));
+ *       }
+ *    }
+ * @endcode
+ */
+
+namespace eos {
+
+/// The version of the snapshot format written by fib_snapshot_writer.
+static const uint32_t FIB_SNAPSHOT_VERSION = 1;
+
+class fib_snapshot_writer_internal;
+
+/**
+ * Accumulates routes and FECs and writes them out as a FIB snapshot.
+ *
+ * Routes and FECs are appended to in-memory columns as they are added,
+ * and commit() writes the whole snapshot to disk in one pass.
+ */
+class EOS_SDK_PUBLIC fib_snapshot_writer {
+ public:
+   explicit fib_snapshot_writer(std::string const & path);
+   ~fib_snapshot_writer();
+
+   /// Adds a route to the snapshot.
+   void route_add(fib_route_t const & route);
+   /// Adds a FEC, and all of its vias, to the snapshot.
+   void fec_add(fib_fec_t const & fec);
+
+   /**
+    * Writes the snapshot to the file given at construction time.
+    *
+    * The file is written under a temporary name and renamed into place,
+    * so readers never observe a partially written snapshot. Returns
+    * false if the file could not be written.
+    */
+   bool commit();
+
+ private:
+   fib_snapshot_writer_internal * writer_;
+   EOS_SDK_DISALLOW_COPY_CTOR(fib_snapshot_writer);
+};
+
+class fib_snapshot_reader_internal;
+
+/**
+ * Provides read-only, zero-copy access to a FIB snapshot file.
+ *
+ * The file is memory-mapped for the lifetime of the reader. Accessors
+ * taking an index must be given a value lower than the corresponding
+ * count; the column accessors return pointers into the mapped file,
+ * valid until the reader is destroyed.
+ */
+class EOS_SDK_PUBLIC fib_snapshot_reader {
+ public:
+   explicit fib_snapshot_reader(std::string const & path);
+   ~fib_snapshot_reader();
+
+   /**
+    * Returns true if the file was mapped and holds a snapshot of a
+    * supported version. No other accessor may be used otherwise.
+    */
+   bool valid() const;
+   /// The format version the snapshot was written with.
+   uint32_t version() const;
+
+   uint64_t route_count() const;
+   uint64_t fec_count() const;
+   uint64_t via_count() const;
+
+   /// Returns the route at the given index.
+   fib_route_t route(uint64_t index) const;
+   /// Returns the FEC at the given index, including its vias.
+   fib_fec_t fec(uint64_t index) const;
+   /**
+    * Returns the index of the FEC with the given id, or fec_count() if
+    * the snapshot has no such FEC.
+    */
+   uint64_t fec_index(uint64_t fec_id) const;
+
+   /// The FEC id of every route, indexed by route.
+   uint64_t const * route_fec_ids() const;
+   /// The metric of every route, indexed by route.
+   uint32_t const * route_metrics() const;
+   /// The id of every FEC, in increasing order, indexed by FEC.
+   uint64_t const * fec_ids() const;
+   /// The number of vias of every FEC, indexed by FEC.
+   uint32_t const * fec_via_counts() const;
+
+ private:
+   fib_snapshot_reader_internal * reader_;
+   EOS_SDK_DISALLOW_COPY_CTOR(fib_snapshot_reader);
+};
+
+}
+
+#endif // EOS_FIB_SNAPSHOT_H
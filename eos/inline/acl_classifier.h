@@ -0,0 +1,105 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_INLINE_ACL_CLASSIFIER_H
+#define EOS_INLINE_ACL_CLASSIFIER_H
+
+namespace eos {
+
+inline acl_packet_t::acl_packet_t() :
+      source_addr_(), destination_addr_(), ip_protocol_(0), source_port_(0),
+      destination_port_(0), ttl_(0), tos_(0), tcp_flags_(0) {
+}
+
+inline acl_packet_t::acl_packet_t(ip_addr_t const & source_addr,
+                                  ip_addr_t const & destination_addr,
+                                  uint8_t ip_protocol, uint16_t source_port,
+                                  uint16_t destination_port) :
+      source_addr_(source_addr), destination_addr_(destination_addr),
+      ip_protocol_(ip_protocol), source_port_(source_port),
+      destination_port_(destination_port), ttl_(0), tos_(0), tcp_flags_(0) {
+}
+
+inline ip_addr_t
+acl_packet_t::source_addr() const {
+   return source_addr_;
+}
+
+inline void
+acl_packet_t::source_addr_is(ip_addr_t const & source_addr) {
+   source_addr_ = source_addr;
+}
+
+inline ip_addr_t
+acl_packet_t::destination_addr() const {
+   return destination_addr_;
+}
+
+inline void
+acl_packet_t::destination_addr_is(ip_addr_t const & destination_addr) {
+   destination_addr_ = destination_addr;
+}
+
+inline uint8_t
+acl_packet_t::ip_protocol() const {
+   return ip_protocol_;
+}
+
+inline void
+acl_packet_t::ip_protocol_is(uint8_t ip_protocol) {
+   ip_protocol_ = ip_protocol;
+}
+
+inline uint16_t
+acl_packet_t::source_port() const {
+   return source_port_;
+}
+
+inline void
+acl_packet_t::source_port_is(uint16_t source_port) {
+   source_port_ = source_port;
+}
+
+inline uint16_t
+acl_packet_t::destination_port() const {
+   return destination_port_;
+}
+
+inline void
+acl_packet_t::destination_port_is(uint16_t destination_port) {
+   destination_port_ = destination_port;
+}
+
+inline uint8_t
+acl_packet_t::ttl() const {
+   return ttl_;
+}
+
+inline void
+acl_packet_t::ttl_is(uint8_t ttl) {
+   ttl_ = ttl;
+}
+
+inline uint8_t
+acl_packet_t::tos() const {
+   return tos_;
+}
+
+inline void
+acl_packet_t::tos_is(uint8_t tos) {
+   tos_ = tos;
+}
+
+inline uint16_t
+acl_packet_t::tcp_flags() const {
+   return tcp_flags_;
+}
+
+inline void
+acl_packet_t::tcp_flags_is(uint16_t tcp_flags) {
+   tcp_flags_ = tcp_flags;
+}
+
+}  // end namespace eos
+
+#endif // EOS_INLINE_ACL_CLASSIFIER_H
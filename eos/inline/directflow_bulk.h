@@ -0,0 +1,37 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_INLINE_DIRECTFLOW_BULK_H
+#define EOS_INLINE_DIRECTFLOW_BULK_H
+
+namespace eos {
+
+inline flow_status_change_t::flow_status_change_t() :
+      name_(), status_(FLOW_STATUS_UNKNOWN),
+      rejected_reason_(FLOW_REJECTED_OTHER) {
+}
+
+inline flow_status_change_t::flow_status_change_t(
+      std::string const & name, flow_status_t status,
+      flow_rejected_reason_t rejected_reason) :
+      name_(name), status_(status), rejected_reason_(rejected_reason) {
+}
+
+inline std::string const &
+flow_status_change_t::name() const {
+   return name_;
+}
+
+inline flow_status_t
+flow_status_change_t::status() const {
+   return status_;
+}
+
+inline flow_rejected_reason_t
+flow_status_change_t::rejected_reason() const {
+   return rejected_reason_;
+}
+
+}
+
+#endif // EOS_INLINE_DIRECTFLOW_BULK_H
@@ -0,0 +1,96 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_INLINE_DIRECTFLOW_CLASSIFIER_H
+#define EOS_INLINE_DIRECTFLOW_CLASSIFIER_H
+
+namespace eos {
+
+inline flow_packet_t::flow_packet_t() :
+      input_intf_(), eth_src_(), eth_dst_(), eth_type_(0), vlan_id_(0), cos_(0),
+      ip_src_(), ip_dst_() {
+}
+
+inline intf_id_t
+flow_packet_t::input_intf() const {
+   return input_intf_;
+}
+
+inline void
+flow_packet_t::input_intf_is(intf_id_t input_intf) {
+   input_intf_ = input_intf;
+}
+
+inline eth_addr_t
+flow_packet_t::eth_src() const {
+   return eth_src_;
+}
+
+inline void
+flow_packet_t::eth_src_is(eth_addr_t eth_src) {
+   eth_src_ = eth_src;
+}
+
+inline eth_addr_t
+flow_packet_t::eth_dst() const {
+   return eth_dst_;
+}
+
+inline void
+flow_packet_t::eth_dst_is(eth_addr_t eth_dst) {
+   eth_dst_ = eth_dst;
+}
+
+inline eth_type_t
+flow_packet_t::eth_type() const {
+   return eth_type_;
+}
+
+inline void
+flow_packet_t::eth_type_is(eth_type_t eth_type) {
+   eth_type_ = eth_type;
+}
+
+inline vlan_id_t
+flow_packet_t::vlan_id() const {
+   return vlan_id_;
+}
+
+inline void
+flow_packet_t::vlan_id_is(vlan_id_t vlan_id) {
+   vlan_id_ = vlan_id;
+}
+
+inline cos_t
+flow_packet_t::cos() const {
+   return cos_;
+}
+
+inline void
+flow_packet_t::cos_is(cos_t cos) {
+   cos_ = cos;
+}
+
+inline ip_addr_t
+flow_packet_t::ip_src() const {
+   return ip_src_;
+}
+
+inline void
+flow_packet_t::ip_src_is(ip_addr_t const & ip_src) {
+   ip_src_ = ip_src;
+}
+
+inline ip_addr_t
+flow_packet_t::ip_dst() const {
+   return ip_dst_;
+}
+
+inline void
+flow_packet_t::ip_dst_is(ip_addr_t const & ip_dst) {
+   ip_dst_ = ip_dst;
+}
+
+}
+
+#endif // EOS_INLINE_DIRECTFLOW_CLASSIFIER_H
@@ -0,0 +1,59 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_INLINE_SBFD_RTT_AGGREGATOR_H
+#define EOS_INLINE_SBFD_RTT_AGGREGATOR_H
+
+namespace eos {
+
+inline sbfd_rtt_summary_t::sbfd_rtt_summary_t() :
+      samples_(0), min_rtt_(0), max_rtt_(0), p50_rtt_(0), p99_rtt_(0),
+      p999_rtt_(0), jitter_(0) {
+}
+
+inline sbfd_rtt_summary_t::sbfd_rtt_summary_t(
+      uint64_t samples, uint32_t min_rtt, uint32_t max_rtt, uint32_t p50_rtt,
+      uint32_t p99_rtt, uint32_t p999_rtt, uint32_t jitter) :
+      samples_(samples), min_rtt_(min_rtt), max_rtt_(max_rtt),
+      p50_rtt_(p50_rtt), p99_rtt_(p99_rtt), p999_rtt_(p999_rtt),
+      jitter_(jitter) {
+}
+
+inline uint64_t
+sbfd_rtt_summary_t::samples() const {
+   return samples_;
+}
+
+inline uint32_t
+sbfd_rtt_summary_t::min_rtt() const {
+   return min_rtt_;
+}
+
+inline uint32_t
+sbfd_rtt_summary_t::max_rtt() const {
+   return max_rtt_;
+}
+
+inline uint32_t
+sbfd_rtt_summary_t::p50_rtt() const {
+   return p50_rtt_;
+}
+
+inline uint32_t
+sbfd_rtt_summary_t::p99_rtt() const {
+   return p99_rtt_;
+}
+
+inline uint32_t
+sbfd_rtt_summary_t::p999_rtt() const {
+   return p999_rtt_;
+}
+
+inline uint32_t
+sbfd_rtt_summary_t::jitter() const {
+   return jitter_;
+}
+
+}
+
+#endif // EOS_INLINE_SBFD_RTT_AGGREGATOR_H
@@ -4,6 +4,8 @@
 #ifndef EOS_INLINE_TYPES_ACL_H
 #define EOS_INLINE_TYPES_ACL_H
 
+#include <algorithm>
+
 namespace eos {
 
 EOS_SDK_PUBLIC std::ostream&
@@ -166,6 +168,255 @@ operator<<(std::ostream& os, const acl_ttl_spec_t& obj) {
 }
 
 
+// A set keeps a bitmap of its ports once a binary search over its ranges
+// takes more probes than a few, provided the set is dense enough: the bitmap
+// covers the words from the first to the last port of the set, and takes at
+// most this many words per range.
+static const size_t ACL_PORT_RANGE_SET_BITMAP_MIN_RANGES = 8;
+static const size_t ACL_PORT_RANGE_SET_BITMAP_WORDS_PER_RANGE = 1;
+
+/// Returns the bits of the bitmap word w covering the ports low to high.
+static inline uint64_t
+acl_port_word_mask(uint32_t w, uint32_t low, uint32_t high) {
+   uint32_t lo = std::max(low, w * 64) - w * 64;
+   uint32_t hi = std::min(high, w * 64 + 63) - w * 64;
+   return (~uint64_t(0) << lo) & (~uint64_t(0) >> (63 - hi));
+}
+
+acl_port_range_set_t::acl_port_range_set_t() :
+      ranges_(), bitmap_base_(0), bitmap_() {
+}
+
+bool
+acl_port_range_set_t::empty() const {
+   return ranges_.empty();
+}
+
+std::vector<std::pair<uint16_t, uint16_t>> const &
+acl_port_range_set_t::ranges() const {
+   return ranges_;
+}
+
+void
+acl_port_range_set_t::ranges_is(
+      std::vector<std::pair<uint16_t, uint16_t>> const & ranges) {
+   ranges_ = ranges;
+   ranges_normalize();
+}
+
+void
+acl_port_range_set_t::ranges_is(
+      std::vector<std::pair<uint16_t, uint16_t>> && ranges) {
+   ranges_ = std::move(ranges);
+   ranges_normalize();
+}
+
+void
+acl_port_range_set_t::range_set(uint16_t low, uint16_t high) {
+   if(low > high) {
+      return;
+   }
+   // First range that ends at or after low - 1, i.e. that may merge with
+   // the new one.
+   auto first = std::lower_bound(
+      ranges_.begin(), ranges_.end(), low,
+      [](std::pair<uint16_t, uint16_t> const & range, uint16_t port) {
+         return uint32_t(range.second) + 1 < port;
+      });
+   auto last = first;
+   uint16_t new_low = low;
+   uint16_t new_high = high;
+   while(last != ranges_.end() && last->first <= uint32_t(high) + 1) {
+      new_low = std::min(new_low, last->first);
+      new_high = std::max(new_high, last->second);
+      ++last;
+   }
+   if(first != last) {
+      *first = std::make_pair(new_low, new_high);
+      ranges_.erase(first + 1, last);
+   } else {
+      ranges_.insert(first, std::make_pair(new_low, new_high));
+   }
+   bitmap_update(low, high, true);
+}
+
+void
+acl_port_range_set_t::range_del(uint16_t low, uint16_t high) {
+   if(low > high) {
+      return;
+   }
+   // First range ending at or after low, then the ranges overlapping.
+   auto first = std::lower_bound(
+      ranges_.begin(), ranges_.end(), low,
+      [](std::pair<uint16_t, uint16_t> const & range, uint16_t port) {
+         return range.second < port;
+      });
+   auto last = first;
+   while(last != ranges_.end() && last->first <= high) {
+      ++last;
+   }
+   if(first == last) {
+      return;
+   }
+   // Keep the parts of the first and last ranges outside of low to high.
+   std::pair<uint16_t, uint16_t> head = *first;
+   std::pair<uint16_t, uint16_t> tail = *(last - 1);
+   first = ranges_.erase(first, last);
+   if(tail.second > high) {
+      first = ranges_.insert(first, std::make_pair(uint16_t(high + 1),
+                                                   tail.second));
+   }
+   if(head.first < low) {
+      ranges_.insert(first, std::make_pair(head.first, uint16_t(low - 1)));
+   }
+   bitmap_update(low, high, false);
+}
+
+void
+acl_port_range_set_t::clear() {
+   ranges_.clear();
+   bitmap_.clear();
+}
+
+bool
+acl_port_range_set_t::contains(uint16_t port) const {
+   if(!bitmap_.empty()) {
+      uint32_t w = uint32_t(port >> 6) - bitmap_base_;
+      return w < bitmap_.size() && ((bitmap_[w] >> (port & 63)) & 1);
+   }
+   // First range ending at or after port.
+   auto it = std::lower_bound(
+      ranges_.begin(), ranges_.end(), port,
+      [](std::pair<uint16_t, uint16_t> const & range, uint16_t p) {
+         return range.second < p;
+      });
+   return it != ranges_.end() && it->first <= port;
+}
+
+void
+acl_port_range_set_t::ranges_normalize() {
+   ranges_.erase(std::remove_if(
+      ranges_.begin(), ranges_.end(),
+      [](std::pair<uint16_t, uint16_t> const & range) {
+         return range.first > range.second;
+      }), ranges_.end());
+   if(!std::is_sorted(ranges_.begin(), ranges_.end())) {
+      std::sort(ranges_.begin(), ranges_.end());
+   }
+   // Merge the overlapping and adjacent ranges in place.
+   size_t merged = 0;
+   for(auto const & range : ranges_) {
+      if(merged && uint32_t(ranges_[merged - 1].second) + 1 >= range.first) {
+         ranges_[merged - 1].second = std::max(ranges_[merged - 1].second,
+                                               range.second);
+      } else {
+         ranges_[merged++] = range;
+      }
+   }
+   ranges_.resize(merged);
+   bitmap_build();
+}
+
+bool
+acl_port_range_set_t::bitmap_wanted() const {
+   if(ranges_.size() < ACL_PORT_RANGE_SET_BITMAP_MIN_RANGES) {
+      return false;
+   }
+   size_t words = ranges_.back().second / 64 - ranges_.front().first / 64 + 1;
+   return words <= ranges_.size() * ACL_PORT_RANGE_SET_BITMAP_WORDS_PER_RANGE;
+}
+
+void
+acl_port_range_set_t::bitmap_build() {
+   if(!bitmap_wanted()) {
+      bitmap_.clear();
+      return;
+   }
+   bitmap_base_ = ranges_.front().first / 64;
+   bitmap_.assign(ranges_.back().second / 64 - bitmap_base_ + 1, 0);
+   for(auto const & range : ranges_) {
+      bitmap_fill(range.first, range.second, true);
+   }
+}
+
+void
+acl_port_range_set_t::bitmap_update(uint16_t low, uint16_t high, bool set) {
+   // The bitmap is patched in place while it still covers the set exactly,
+   // and built again when the first or last word of the set moved.
+   if(bitmap_.empty() || !bitmap_wanted() ||
+      ranges_.front().first / 64 != bitmap_base_ ||
+      ranges_.back().second / 64 != bitmap_base_ + bitmap_.size() - 1) {
+      bitmap_build();
+      return;
+   }
+   bitmap_fill(low, high, set);
+}
+
+void
+acl_port_range_set_t::bitmap_fill(uint16_t low, uint16_t high, bool set) {
+   for(uint32_t w = low / 64; w <= uint32_t(high / 64); ++w) {
+      uint64_t mask = acl_port_word_mask(w, low, high);
+      if(set) {
+         bitmap_[w - bitmap_base_] |= mask;
+      } else {
+         bitmap_[w - bitmap_base_] &= ~mask;
+      }
+   }
+}
+
+bool
+acl_port_range_set_t::operator==(acl_port_range_set_t const & other) const {
+   return ranges_ == other.ranges_;
+}
+
+bool
+acl_port_range_set_t::operator!=(acl_port_range_set_t const & other) const {
+   return !operator==(other);
+}
+
+uint32_t
+acl_port_range_set_t::hash() const {
+   hash_mix h;
+   mix_me(h);
+   return h.result();
+}
+
+void
+acl_port_range_set_t::mix_me(hash_mix & h) const {
+   for(auto const & range : ranges_) {
+      h.mix(range.first); // uint16_t
+      h.mix(range.second); // uint16_t
+   }
+}
+
+std::string
+acl_port_range_set_t::to_string() const {
+   std::ostringstream ss;
+   ss << "acl_port_range_set_t(";
+   ss << "ranges='";
+   bool first_range = true;
+   for(auto const & range : ranges_) {
+      if(!first_range) {
+         ss << ",";
+      }
+      first_range = false;
+      ss << range.first;
+      if(range.second != range.first) {
+         ss << "-" << range.second;
+      }
+   }
+   ss << "'";
+   ss << ")";
+   return ss.str();
+}
+
+std::ostream&
+operator<<(std::ostream& os, const acl_port_range_set_t& obj) {
+   os << obj.to_string();
+   return os;
+}
+
+
 acl_range_operator_t
 acl_port_spec_t::oper() const {
    return pimpl->oper();
@@ -198,6 +449,14 @@ void
 acl_port_spec_t::port_del(uint16_t const & ports) {
    pimpl->port_del(ports);
 }
+acl_port_range_set_t const &
+acl_port_spec_t::port_ranges() const {
+   return pimpl->port_ranges();
+}
+bool
+acl_port_spec_t::port_match(uint16_t port) const {
+   return pimpl->port_match(port);
+}
 bool
 acl_port_spec_t::operator==(acl_port_spec_t const & other) const {
    return pimpl->operator==(*other.pimpl);
@@ -548,6 +807,12 @@ operator<<(std::ostream& os, const acl_rule_ip_t& obj) {
    return operator<<(os, *obj.pimpl);
 }
 
+bool
+acl_rule_ip_equal(acl_rule_ip_t const & a, acl_rule_ip_t const & b) {
+   return a == b && a.action() == b.action() && a.log() == b.log() &&
+          a.tracked() == b.tracked();
+}
+
 
 vlan_id_t
 acl_rule_eth_t::vlan() const {
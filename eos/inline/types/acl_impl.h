@@ -4,6 +4,8 @@
 #ifndef EOS_INLINE_TYPES_ACL_IMPL_H
 #define EOS_INLINE_TYPES_ACL_IMPL_H
 
+#include <algorithm>
+
 namespace eos {
 
 
@@ -104,16 +106,25 @@ operator<<(std::ostream& os, const acl_ttl_spec_impl_t& obj) {
 
 acl_port_spec_impl_t::acl_port_spec_impl_t() :
       oper_(ACL_RANGE_ANY), ports_() {
+   ports_changed();
 }
 
 acl_port_spec_impl_t::acl_port_spec_impl_t(
          acl_range_operator_t oper, std::list<uint16_t> const & ports) :
-      oper_(oper) {
-   for (std::list<uint16_t>::const_iterator pit = ports.cbegin();
-        pit != ports.cend(); ++pit) {
-        ports_.push_back(*pit);
-   }
+      oper_(oper), ports_(ports) {
+   ports_changed();
+}
 
+acl_port_spec_impl_t::acl_port_spec_impl_t(
+         acl_range_operator_t oper, uint16_t port) :
+      oper_(oper), ports_(1, port) {
+   ports_changed();
+}
+
+acl_port_spec_impl_t::acl_port_spec_impl_t(
+         acl_range_operator_t oper, uint16_t low, uint16_t high) :
+      oper_(oper), ports_({low, high}) {
+   ports_changed();
 }
 
 acl_range_operator_t
@@ -124,6 +135,7 @@ acl_port_spec_impl_t::oper() const {
 void
 acl_port_spec_impl_t::oper_is(acl_range_operator_t oper) {
    oper_ = oper;
+   ports_changed();
 }
 
 std::list<uint16_t> const &
@@ -134,26 +146,116 @@ acl_port_spec_impl_t::ports() const {
 void
 acl_port_spec_impl_t::ports_is(std::list<uint16_t> const & ports) {
    ports_ = ports;
+   ports_changed();
 }
 
 void
 acl_port_spec_impl_t::ports_is(std::list<uint16_t> && ports) {
    ports_ = std::move(ports);
+   ports_changed();
 }
 
 void
 acl_port_spec_impl_t::port_set(uint16_t const & ports) {
    ports_.push_front(ports);
+   port_added(ports);
 }
 
 void
 acl_port_spec_impl_t::port_set(uint16_t && ports) {
-   ports_.push_front(std::move(ports));
+   ports_.push_front(ports);
+   port_added(ports);
 }
 
 void
 acl_port_spec_impl_t::port_del(uint16_t const & ports) {
    ports_.remove(ports);
+   // Every occurrence of the port is removed.
+   if(oper_ == ACL_RANGE_EQ) {
+      port_ranges_.range_del(ports, ports);
+   } else if(oper_ == ACL_RANGE_NEQ) {
+      port_ranges_.range_set(ports, ports);
+   } else {
+      ports_changed();
+   }
+}
+
+acl_port_range_set_t const &
+acl_port_spec_impl_t::port_ranges() const {
+   return port_ranges_;
+}
+
+bool
+acl_port_spec_impl_t::port_match(uint16_t port) const {
+   return port_ranges_.contains(port);
+}
+
+void
+acl_port_spec_impl_t::port_added(uint16_t port) {
+   if(oper_ == ACL_RANGE_EQ) {
+      port_ranges_.range_set(port, port);
+   } else if(oper_ == ACL_RANGE_NEQ) {
+      port_ranges_.range_del(port, port);
+   } else {
+      // The other operators depend on the position of the ports.
+      ports_changed();
+   }
+}
+
+void
+acl_port_spec_impl_t::ports_changed() {
+   std::vector<std::pair<uint16_t, uint16_t>> ranges;
+   switch(oper_) {
+    case ACL_RANGE_EQ:
+    case ACL_RANGE_NEQ: {
+      std::vector<uint16_t> ports(ports_.cbegin(), ports_.cend());
+      std::sort(ports.begin(), ports.end());
+      if(oper_ == ACL_RANGE_EQ) {
+         for(auto port : ports) {
+            if(!ranges.empty() && uint32_t(ranges.back().second) + 1 >= port) {
+               ranges.back().second = port;
+            } else {
+               ranges.push_back(std::make_pair(port, port));
+            }
+         }
+         break;
+      }
+      // The ranges between the ports not matched.
+      uint32_t next = 0;
+      for(auto port : ports) {
+         if(port > next) {
+            ranges.push_back(std::make_pair(uint16_t(next), uint16_t(port - 1)));
+         }
+         next = std::max(next, uint32_t(port) + 1);
+      }
+      if(next <= 65535) {
+         ranges.push_back(std::make_pair(uint16_t(next), uint16_t(65535)));
+      }
+      break;
+    }
+    case ACL_RANGE_LT:
+      if(!ports_.empty() && ports_.front() > 0) {
+         ranges.push_back(std::make_pair(uint16_t(0),
+                                         uint16_t(ports_.front() - 1)));
+      }
+      break;
+    case ACL_RANGE_GT:
+      if(!ports_.empty() && ports_.front() < 65535) {
+         ranges.push_back(std::make_pair(uint16_t(ports_.front() + 1),
+                                         uint16_t(65535)));
+      }
+      break;
+    case ACL_RANGE_BETWEEN:
+      if(ports_.size() == 2) {
+         ranges.push_back(std::make_pair(ports_.front(), ports_.back()));
+      }
+      break;
+    default:
+      // ACL_RANGE_ANY and ACL_RANGE_NULL match every port.
+      ranges.push_back(std::make_pair(uint16_t(0), uint16_t(65535)));
+      break;
+   }
+   port_ranges_.ranges_is(std::move(ranges));
 }
 
 bool
@@ -224,8 +326,7 @@ operator<<(std::ostream& os, const acl_port_spec_impl_t& obj) {
 
 acl_port_spec_t
 get_acl_port_spec_eq(uint16_t port) {
-   std::list<uint16_t> l = { port };
-   return acl_port_spec_t( ACL_RANGE_EQ, l );
+   return acl_port_spec_t( ACL_RANGE_EQ, port );
 }
 
 
@@ -237,8 +338,7 @@ get_acl_port_spec_eq(std::list<uint16_t> const & ports) {
 
 acl_port_spec_t
 get_acl_port_spec_neq(uint16_t port) {
-   std::list<uint16_t> l = { port };
-   return acl_port_spec_t( ACL_RANGE_NEQ, l );
+   return acl_port_spec_t( ACL_RANGE_NEQ, port );
 }
 
 
@@ -250,22 +350,19 @@ get_acl_port_spec_neq(std::list<uint16_t> const & ports) {
 
 acl_port_spec_t
 get_acl_port_spec_between(uint16_t low, uint16_t high) {
-   std::list<uint16_t> l = { low, high };
-   return acl_port_spec_t( ACL_RANGE_BETWEEN, l );
+   return acl_port_spec_t( ACL_RANGE_BETWEEN, low, high );
 }
 
 
 acl_port_spec_t
 get_acl_port_spec_gt(uint16_t port) {
-   std::list<uint16_t> l = { port };
-   return acl_port_spec_t( ACL_RANGE_GT, l );
+   return acl_port_spec_t( ACL_RANGE_GT, port );
 }
 
 
 acl_port_spec_t
 get_acl_port_spec_lt(uint16_t port) {
-   std::list<uint16_t> l = { port };
-   return acl_port_spec_t( ACL_RANGE_LT, l );
+   return acl_port_spec_t( ACL_RANGE_LT, port );
 }
 
 
@@ -32,6 +32,21 @@ operator<<(std::ostream& os, const bgp_receive_route_stage_t & enum_val) {
 }
 
 
+EOS_SDK_PUBLIC std::ostream&
+operator<<(std::ostream& os, const bgp_path_change_type_t & enum_val) {
+   if (enum_val==BGP_PATH_ADDED) {
+      os << "BGP_PATH_ADDED";
+   } else if (enum_val==BGP_PATH_UPDATED) {
+      os << "BGP_PATH_UPDATED";
+   } else if (enum_val==BGP_PATH_DELETED) {
+      os << "BGP_PATH_DELETED";
+   } else {
+      os << "Unknown value";
+   }
+   return os;
+}
+
+
 bool
 bgp_path_attr_fields_t::next_hop() const {
    return pimpl->next_hop();
@@ -97,6 +112,122 @@ bgp_path_options_t::path_attr_fields_is(bgp_path_attr_fields_t && path_attr_fiel
        {
    pimpl->path_attr_fields_is(std::move(path_attr_fields));
 }
+std::set<ip_prefix_t> const &
+bgp_path_options_t::prefixes() const {
+   return pimpl->prefixes();
+}
+void
+bgp_path_options_t::prefixes_is(std::set<ip_prefix_t> const & prefixes) {
+   pimpl->prefixes_is(prefixes);
+}
+void
+bgp_path_options_t::prefixes_is(std::set<ip_prefix_t> && prefixes) {
+   pimpl->prefixes_is(std::move(prefixes));
+}
+void
+bgp_path_options_t::prefix_set(ip_prefix_t const & value) {
+   pimpl->prefix_set(value);
+}
+void
+bgp_path_options_t::prefix_set(ip_prefix_t && value) {
+   pimpl->prefix_set(std::move(value));
+}
+void
+bgp_path_options_t::prefix_del(ip_prefix_t const & value) {
+   pimpl->prefix_del(value);
+}
+std::unordered_set<ip_addr_t> const &
+bgp_path_options_t::peer_addrs() const {
+   return pimpl->peer_addrs();
+}
+void
+bgp_path_options_t::peer_addrs_is(std::unordered_set<ip_addr_t> const & peer_addrs) {
+   pimpl->peer_addrs_is(peer_addrs);
+}
+void
+bgp_path_options_t::peer_addrs_is(std::unordered_set<ip_addr_t> && peer_addrs) {
+   pimpl->peer_addrs_is(std::move(peer_addrs));
+}
+void
+bgp_path_options_t::peer_addr_set(ip_addr_t const & value) {
+   pimpl->peer_addr_set(value);
+}
+void
+bgp_path_options_t::peer_addr_set(ip_addr_t && value) {
+   pimpl->peer_addr_set(std::move(value));
+}
+void
+bgp_path_options_t::peer_addr_del(ip_addr_t const & value) {
+   pimpl->peer_addr_del(value);
+}
+std::unordered_set<uint32_t> const &
+bgp_path_options_t::communities() const {
+   return pimpl->communities();
+}
+void
+bgp_path_options_t::communities_is(std::unordered_set<uint32_t> const & communities) {
+   pimpl->communities_is(communities);
+}
+void
+bgp_path_options_t::communities_is(std::unordered_set<uint32_t> && communities) {
+   pimpl->communities_is(std::move(communities));
+}
+void
+bgp_path_options_t::community_set(uint32_t const & value) {
+   pimpl->community_set(value);
+}
+void
+bgp_path_options_t::community_set(uint32_t && value) {
+   pimpl->community_set(std::move(value));
+}
+void
+bgp_path_options_t::community_del(uint32_t const & value) {
+   pimpl->community_del(value);
+}
+std::unordered_set<ip_addr_t> const &
+bgp_path_options_t::next_hops() const {
+   return pimpl->next_hops();
+}
+void
+bgp_path_options_t::next_hops_is(std::unordered_set<ip_addr_t> const & next_hops) {
+   pimpl->next_hops_is(next_hops);
+}
+void
+bgp_path_options_t::next_hops_is(std::unordered_set<ip_addr_t> && next_hops) {
+   pimpl->next_hops_is(std::move(next_hops));
+}
+void
+bgp_path_options_t::next_hop_set(ip_addr_t const & value) {
+   pimpl->next_hop_set(value);
+}
+void
+bgp_path_options_t::next_hop_set(ip_addr_t && value) {
+   pimpl->next_hop_set(std::move(value));
+}
+void
+bgp_path_options_t::next_hop_del(ip_addr_t const & value) {
+   pimpl->next_hop_del(value);
+}
+uint32_t
+bgp_path_options_t::page_size() const {
+   return pimpl->page_size();
+}
+void
+bgp_path_options_t::page_size_is(uint32_t page_size) {
+   pimpl->page_size_is(page_size);
+}
+std::string
+bgp_path_options_t::page_token() const {
+   return pimpl->page_token();
+}
+void
+bgp_path_options_t::page_token_is(std::string const & page_token) {
+   pimpl->page_token_is(page_token);
+}
+void
+bgp_path_options_t::page_token_is(std::string && page_token) {
+   pimpl->page_token_is(std::move(page_token));
+}
 bool
 bgp_path_options_t::operator==(bgp_path_options_t const & other) const {
    return pimpl->operator==(*other.pimpl);
@@ -184,6 +315,19 @@ void
 bgp_path_attr_t::community_list_del(uint32_t const & value) {
    pimpl->community_list_del(value);
 }
+std::vector<uint32_t> const &
+bgp_path_attr_t::community_list_sorted() const {
+   return pimpl->community_list_sorted();
+}
+void
+bgp_path_attr_t::community_list_sorted_is(
+         std::vector<uint32_t> const & community_list) {
+   pimpl->community_list_sorted_is(community_list);
+}
+bool
+bgp_path_attr_t::community_list_contains(uint32_t value) const {
+   return pimpl->community_list_contains(value);
+}
 bool
 bgp_path_attr_t::operator==(bgp_path_attr_t const & other) const {
    return pimpl->operator==(*other.pimpl);
@@ -325,6 +469,60 @@ operator<<(std::ostream& os, const bgp_path_t& obj) {
    return operator<<(os, *obj.pimpl);
 }
 
+
+uint64_t
+bgp_path_change_t::seq() const {
+   return pimpl->seq();
+}
+void
+bgp_path_change_t::seq_is(uint64_t seq) {
+   pimpl->seq_is(seq);
+}
+bgp_path_change_type_t
+bgp_path_change_t::type() const {
+   return pimpl->type();
+}
+void
+bgp_path_change_t::type_is(bgp_path_change_type_t type) {
+   pimpl->type_is(type);
+}
+bgp_path_t
+bgp_path_change_t::path() const {
+   return pimpl->path();
+}
+void
+bgp_path_change_t::path_is(bgp_path_t const & path) {
+   pimpl->path_is(path);
+}
+void
+bgp_path_change_t::path_is(bgp_path_t && path) {
+   pimpl->path_is(std::move(path));
+}
+bool
+bgp_path_change_t::operator==(bgp_path_change_t const & other) const {
+   return pimpl->operator==(*other.pimpl);
+}
+bool
+bgp_path_change_t::operator!=(bgp_path_change_t const & other) const {
+   return pimpl->operator!=(*other.pimpl);
+}
+uint32_t
+bgp_path_change_t::hash() const {
+   return pimpl->hash();
+}
+void
+bgp_path_change_t::mix_me(hash_mix & h) const {
+   pimpl->mix_me(h);
+}
+std::string
+bgp_path_change_t::to_string() const {
+   return pimpl->to_string();
+}
+std::ostream&
+operator<<(std::ostream& os, const bgp_path_change_t& obj) {
+   return operator<<(os, *obj.pimpl);
+}
+
 }
 
 #endif // EOS_INLINE_TYPES_BGP_PATH_H
@@ -83,12 +83,14 @@ operator<<(std::ostream& os, const bgp_path_attr_fields_impl_t& obj) {
 
 
 bgp_path_options_impl_t::bgp_path_options_impl_t() :
-      receive_route_stage_(), path_attr_fields_() {
+      receive_route_stage_(), path_attr_fields_(), prefixes_(), peer_addrs_(),
+      communities_(), next_hops_(), page_size_(), page_token_() {
 }
 
 bgp_path_options_impl_t::bgp_path_options_impl_t(
          bgp_receive_route_stage_t receive_route_stage) :
-      receive_route_stage_(receive_route_stage), path_attr_fields_() {
+      receive_route_stage_(receive_route_stage), path_attr_fields_(), prefixes_(), peer_addrs_(),
+      communities_(), next_hops_(), page_size_(), page_token_() {
 }
 
 bgp_receive_route_stage_t
@@ -119,10 +121,161 @@ bgp_path_options_impl_t::path_attr_fields_is(
    path_attr_fields_ = std::move(path_attr_fields);
 }
 
+std::set<ip_prefix_t> const &
+bgp_path_options_impl_t::prefixes() const {
+   return prefixes_;
+}
+
+void
+bgp_path_options_impl_t::prefixes_is(std::set<ip_prefix_t> const & prefixes) {
+   prefixes_ = prefixes;
+}
+
+void
+bgp_path_options_impl_t::prefixes_is(std::set<ip_prefix_t> && prefixes) {
+   prefixes_ = std::move(prefixes);
+}
+
+void
+bgp_path_options_impl_t::prefix_set(ip_prefix_t const & value) {
+   prefixes_.insert(value);
+}
+
+void
+bgp_path_options_impl_t::prefix_set(ip_prefix_t && value) {
+   prefixes_.emplace(std::move(value));
+}
+
+void
+bgp_path_options_impl_t::prefix_del(ip_prefix_t const & value) {
+   prefixes_.erase(value);
+}
+
+std::unordered_set<ip_addr_t> const &
+bgp_path_options_impl_t::peer_addrs() const {
+   return peer_addrs_;
+}
+
+void
+bgp_path_options_impl_t::peer_addrs_is(std::unordered_set<ip_addr_t> const & peer_addrs) {
+   peer_addrs_ = peer_addrs;
+}
+
+void
+bgp_path_options_impl_t::peer_addrs_is(std::unordered_set<ip_addr_t> && peer_addrs) {
+   peer_addrs_ = std::move(peer_addrs);
+}
+
+void
+bgp_path_options_impl_t::peer_addr_set(ip_addr_t const & value) {
+   peer_addrs_.insert(value);
+}
+
+void
+bgp_path_options_impl_t::peer_addr_set(ip_addr_t && value) {
+   peer_addrs_.emplace(std::move(value));
+}
+
+void
+bgp_path_options_impl_t::peer_addr_del(ip_addr_t const & value) {
+   peer_addrs_.erase(value);
+}
+
+std::unordered_set<uint32_t> const &
+bgp_path_options_impl_t::communities() const {
+   return communities_;
+}
+
+void
+bgp_path_options_impl_t::communities_is(std::unordered_set<uint32_t> const & communities) {
+   communities_ = communities;
+}
+
+void
+bgp_path_options_impl_t::communities_is(std::unordered_set<uint32_t> && communities) {
+   communities_ = std::move(communities);
+}
+
+void
+bgp_path_options_impl_t::community_set(uint32_t const & value) {
+   communities_.insert(value);
+}
+
+void
+bgp_path_options_impl_t::community_set(uint32_t && value) {
+   communities_.emplace(std::move(value));
+}
+
+void
+bgp_path_options_impl_t::community_del(uint32_t const & value) {
+   communities_.erase(value);
+}
+
+std::unordered_set<ip_addr_t> const &
+bgp_path_options_impl_t::next_hops() const {
+   return next_hops_;
+}
+
+void
+bgp_path_options_impl_t::next_hops_is(std::unordered_set<ip_addr_t> const & next_hops) {
+   next_hops_ = next_hops;
+}
+
+void
+bgp_path_options_impl_t::next_hops_is(std::unordered_set<ip_addr_t> && next_hops) {
+   next_hops_ = std::move(next_hops);
+}
+
+void
+bgp_path_options_impl_t::next_hop_set(ip_addr_t const & value) {
+   next_hops_.insert(value);
+}
+
+void
+bgp_path_options_impl_t::next_hop_set(ip_addr_t && value) {
+   next_hops_.emplace(std::move(value));
+}
+
+void
+bgp_path_options_impl_t::next_hop_del(ip_addr_t const & value) {
+   next_hops_.erase(value);
+}
+
+uint32_t
+bgp_path_options_impl_t::page_size() const {
+   return page_size_;
+}
+
+void
+bgp_path_options_impl_t::page_size_is(uint32_t page_size) {
+   page_size_ = page_size;
+}
+
+std::string
+bgp_path_options_impl_t::page_token() const {
+   return page_token_;
+}
+
+void
+bgp_path_options_impl_t::page_token_is(std::string const & page_token) {
+   page_token_ = page_token;
+}
+
+void
+bgp_path_options_impl_t::page_token_is(std::string && page_token) {
+   page_token_ = std::move(page_token);
+}
+
 bool
 bgp_path_options_impl_t::operator==(bgp_path_options_impl_t const & other) const {
    return receive_route_stage_ == other.receive_route_stage_ &&
-          path_attr_fields_ == other.path_attr_fields_;
+          path_attr_fields_ == other.path_attr_fields_ &&
+          prefixes_ == other.prefixes_ &&
+          peer_addrs_ == other.peer_addrs_ &&
+          communities_ == other.communities_ &&
+          next_hops_ == other.next_hops_ &&
+          page_size_ == other.page_size_ &&
+          page_token_ == other.page_token_;
 }
 
 bool
@@ -141,6 +294,24 @@ void
 bgp_path_options_impl_t::mix_me(hash_mix & h) const {
    h.mix(receive_route_stage_); // bgp_receive_route_stage_t
    h.mix(path_attr_fields_); // bgp_path_attr_fields_t
+   for (auto it=prefixes_.cbegin();
+        it!=prefixes_.cend(); ++it) {
+      h.mix(*it); // ip_prefix_t
+   }
+   for (auto it=peer_addrs_.cbegin();
+        it!=peer_addrs_.cend(); ++it) {
+      h.mix(*it); // ip_addr_t
+   }
+   for (auto it=communities_.cbegin();
+        it!=communities_.cend(); ++it) {
+      h.mix(*it); // uint32_t
+   }
+   for (auto it=next_hops_.cbegin();
+        it!=next_hops_.cend(); ++it) {
+      h.mix(*it); // ip_addr_t
+   }
+   h.mix(page_size_); // uint32_t
+   h.mix(page_token_); // std::string
 }
 
 std::string
@@ -149,6 +320,56 @@ bgp_path_options_impl_t::to_string() const {
    ss << "bgp_path_options_t(";
    ss << "receive_route_stage=" << receive_route_stage_;
    ss << ", path_attr_fields=" << path_attr_fields_;
+   ss << ", prefixes=" <<"'";
+   bool first_prefixes = true;
+   for (auto it=prefixes_.cbegin();
+        it!=prefixes_.cend(); ++it) {
+      if (first_prefixes) {
+         ss << (*it);
+         first_prefixes = false;
+      } else {
+         ss << "," << (*it);
+      }
+   }
+   ss << "'";
+   ss << ", peer_addrs=" <<"'";
+   bool first_peer_addrs = true;
+   for (auto it=peer_addrs_.cbegin();
+        it!=peer_addrs_.cend(); ++it) {
+      if (first_peer_addrs) {
+         ss << (*it);
+         first_peer_addrs = false;
+      } else {
+         ss << "," << (*it);
+      }
+   }
+   ss << "'";
+   ss << ", communities=" <<"'";
+   bool first_communities = true;
+   for (auto it=communities_.cbegin();
+        it!=communities_.cend(); ++it) {
+      if (first_communities) {
+         ss << (*it);
+         first_communities = false;
+      } else {
+         ss << "," << (*it);
+      }
+   }
+   ss << "'";
+   ss << ", next_hops=" <<"'";
+   bool first_next_hops = true;
+   for (auto it=next_hops_.cbegin();
+        it!=next_hops_.cend(); ++it) {
+      if (first_next_hops) {
+         ss << (*it);
+         first_next_hops = false;
+      } else {
+         ss << "," << (*it);
+      }
+   }
+   ss << "'";
+   ss << ", page_size=" << page_size_;
+   ss << ", page_token='" << page_token_ << "'";
    ss << ")";
    return ss.str();
 }
@@ -218,34 +439,76 @@ bgp_path_attr_impl_t::local_pref_is(uint32_t local_pref) {
 
 std::unordered_set<uint32_t> const &
 bgp_path_attr_impl_t::community_list() const {
-   return community_list_;
+   static std::unordered_set<uint32_t> const empty;
+   return community_list_ ? community_list_->set() : empty;
 }
 
 void
 bgp_path_attr_impl_t::community_list_is(
          std::unordered_set<uint32_t> const & community_list) {
-   community_list_ = community_list;
+   std::vector<uint32_t> list(community_list.begin(), community_list.end());
+   std::sort(list.begin(), list.end());
+   community_list_ = community_list_intern(list);
 }
 
 void
 bgp_path_attr_impl_t::community_list_is(
          std::unordered_set<uint32_t> && community_list) {
-   community_list_ = std::move(community_list);
+   community_list_is(community_list);
 }
 
 void
 bgp_path_attr_impl_t::community_list_set(uint32_t const & value) {
-   community_list_.insert(value);
+   if(community_list_contains(value)) {
+      return;
+   }
+   std::vector<uint32_t> list = community_list_sorted();
+   list.insert(std::lower_bound(list.begin(), list.end(), value), value);
+   community_list_ = community_list_intern(list);
 }
 
 void
 bgp_path_attr_impl_t::community_list_set(uint32_t && value) {
-   community_list_.emplace(std::move(value));
+   community_list_set(value);
 }
 
 void
 bgp_path_attr_impl_t::community_list_del(uint32_t const & value) {
-   community_list_.erase(value);
+   if(!community_list_contains(value)) {
+      return;
+   }
+   std::vector<uint32_t> list = community_list_sorted();
+   list.erase(std::lower_bound(list.begin(), list.end(), value));
+   community_list_ = community_list_intern(list);
+}
+
+std::vector<uint32_t> const &
+bgp_path_attr_impl_t::community_list_sorted() const {
+   static std::vector<uint32_t> const empty;
+   return community_list_ ? community_list_->sorted : empty;
+}
+
+void
+bgp_path_attr_impl_t::community_list_sorted_is(
+         std::vector<uint32_t> const & community_list) {
+   std::vector<uint32_t> list(community_list);
+   std::sort(list.begin(), list.end());
+   list.erase(std::unique(list.begin(), list.end()), list.end());
+   community_list_ = community_list_intern(list);
+}
+
+bool
+bgp_path_attr_impl_t::community_list_contains(uint32_t value) const {
+   std::vector<uint32_t> const & list = community_list_sorted();
+   if(list.size() > 32) {
+      return std::binary_search(list.begin(), list.end(), value);
+   }
+   // Short lists are scanned without branches, which compilers vectorize.
+   bool found = false;
+   for(uint32_t community : list) {
+      found |= community == value;
+   }
+   return found;
 }
 
 bool
@@ -275,8 +538,8 @@ bgp_path_attr_impl_t::mix_me(hash_mix & h) const {
    h.mix(origin_); // uint8_t
    h.mix(med_); // uint32_t
    h.mix(local_pref_); // uint32_t
-   for (auto it=community_list_.cbegin();
-        it!=community_list_.cend(); ++it) {
+   for (auto it=community_list_sorted().cbegin();
+        it!=community_list_sorted().cend(); ++it) {
       h.mix(*it); // uint32_t
    }
 }
@@ -291,8 +554,8 @@ bgp_path_attr_impl_t::to_string() const {
    ss << ", local_pref=" << local_pref_;
    ss << ", community_list=" <<"'";
    bool first_community_list = true;
-   for (auto it=community_list_.cbegin();
-        it!=community_list_.cend(); ++it) {
+   for (auto it=community_list_sorted().cbegin();
+        it!=community_list_sorted().cend(); ++it) {
       if (first_community_list) {
          ss << (*it);
          first_community_list = false;
@@ -504,6 +767,96 @@ operator<<(std::ostream& os, const bgp_path_impl_t& obj) {
 }
 
 
+
+bgp_path_change_impl_t::bgp_path_change_impl_t() :
+      seq_(0), type_(BGP_PATH_ADDED), path_() {
+}
+
+bgp_path_change_impl_t::bgp_path_change_impl_t(uint64_t seq,
+                                               bgp_path_change_type_t type,
+                                               bgp_path_t const & path) :
+      seq_(seq), type_(type), path_(path) {
+}
+
+uint64_t
+bgp_path_change_impl_t::seq() const {
+   return seq_;
+}
+
+void
+bgp_path_change_impl_t::seq_is(uint64_t seq) {
+   seq_ = seq;
+}
+
+bgp_path_change_type_t
+bgp_path_change_impl_t::type() const {
+   return type_;
+}
+
+void
+bgp_path_change_impl_t::type_is(bgp_path_change_type_t type) {
+   type_ = type;
+}
+
+bgp_path_t
+bgp_path_change_impl_t::path() const {
+   return path_;
+}
+
+void
+bgp_path_change_impl_t::path_is(bgp_path_t const & path) {
+   path_ = path;
+}
+
+void
+bgp_path_change_impl_t::path_is(bgp_path_t && path) {
+   path_ = std::move(path);
+}
+
+bool
+bgp_path_change_impl_t::operator==(bgp_path_change_impl_t const & other) const {
+   return seq_ == other.seq_ &&
+          type_ == other.type_ &&
+          path_ == other.path_;
+}
+
+bool
+bgp_path_change_impl_t::operator!=(bgp_path_change_impl_t const & other) const {
+   return !operator==(other);
+}
+
+uint32_t
+bgp_path_change_impl_t::hash() const {
+   hash_mix h;
+   mix_me(h);
+   return h.result();
+}
+
+void
+bgp_path_change_impl_t::mix_me(hash_mix & h) const {
+   h.mix(seq_); // uint64_t
+   h.mix(type_); // bgp_path_change_type_t
+   h.mix(path_); // bgp_path_t
+}
+
+std::string
+bgp_path_change_impl_t::to_string() const {
+   std::ostringstream ss;
+   ss << "bgp_path_change_t(";
+   ss << "seq=" << seq_;
+   ss << ", type=" << type_;
+   ss << ", path=" << path_;
+   ss << ")";
+   return ss.str();
+}
+
+std::ostream&
+operator<<(std::ostream& os, const bgp_path_change_impl_t& obj) {
+   os << obj.to_string();
+   return os;
+}
+
+
 }
 
 #include <eos/inline/types/bgp_path.h>
@@ -12,11 +12,12 @@ class_map_rule_t::acl_key() const {
 }
 bool
 class_map_rule_t::operator==(class_map_rule_t const & other) const {
-   return pimpl->operator==(*other.pimpl);
+   // Copies, and the rules interned by class_map_mgr, share an instance.
+   return pimpl == other.pimpl || pimpl->operator==(*other.pimpl);
 }
 bool
 class_map_rule_t::operator!=(class_map_rule_t const & other) const {
-   return pimpl->operator!=(*other.pimpl);
+   return !operator==(other);
 }
 uint32_t
 class_map_rule_t::hash() const {
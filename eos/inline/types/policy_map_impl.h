@@ -700,13 +700,14 @@ operator<<(std::ostream& os, const traffic_policy_action_impl_t& obj) {
 
 policy_map_rule_impl_t::policy_map_rule_impl_t() :
       class_map_key_(), policy_map_rule_type_(POLICY_RULE_TYPE_CLASSMAP),
-      raw_rule_(), actions_() {
+      raw_rule_(raw_rule_default()), actions_() {
 }
 
 policy_map_rule_impl_t::policy_map_rule_impl_t(
          class_map_key_t const & class_map_key) :
       class_map_key_(class_map_key),
-      policy_map_rule_type_(POLICY_RULE_TYPE_CLASSMAP), raw_rule_(), actions_() {
+      policy_map_rule_type_(POLICY_RULE_TYPE_CLASSMAP),
+      raw_rule_(raw_rule_default()), actions_() {
 }
 
 class_map_key_t
@@ -737,12 +738,12 @@ policy_map_rule_impl_t::policy_map_rule_type_is(
 
 acl_rule_ip_t
 policy_map_rule_impl_t::raw_rule() const {
-   return raw_rule_;
+   return *raw_rule_;
 }
 
 void
 policy_map_rule_impl_t::raw_rule_is(acl_rule_ip_t raw_rule) {
-   raw_rule_ = raw_rule;
+   raw_rule_ = std::make_shared<acl_rule_ip_t const>(raw_rule);
 }
 
 std::set<policy_map_action_t> const &
@@ -798,7 +799,8 @@ bool
 policy_map_rule_impl_t::operator==(policy_map_rule_impl_t const & other) const {
    return class_map_key_ == other.class_map_key_ &&
           policy_map_rule_type_ == other.policy_map_rule_type_ &&
-          raw_rule_ == other.raw_rule_ &&
+          (raw_rule_ == other.raw_rule_ ||
+           raw_rule_equal(*raw_rule_, *other.raw_rule_)) &&
           actions_ == other.actions_;
 }
 
@@ -813,8 +815,19 @@ policy_map_rule_impl_t::operator<(policy_map_rule_impl_t const & other) const {
       return class_map_key_ < other.class_map_key_;
    } else if(policy_map_rule_type_ != other.policy_map_rule_type_) {
       return policy_map_rule_type_ < other.policy_map_rule_type_;
-   } else if(raw_rule_ != other.raw_rule_) {
-      return raw_rule_ < other.raw_rule_;
+   } else if(raw_rule_ != other.raw_rule_ &&
+             !raw_rule_equal(*raw_rule_, *other.raw_rule_)) {
+      acl_rule_ip_t const & lhs = *raw_rule_;
+      acl_rule_ip_t const & rhs = *other.raw_rule_;
+      // acl_rule_ip_t ordering ignores the fields of acl_rule_base_t.
+      if(lhs < rhs || rhs < lhs) {
+         return lhs < rhs;
+      } else if(lhs.action() != rhs.action()) {
+         return lhs.action() < rhs.action();
+      } else if(lhs.log() != rhs.log()) {
+         return lhs.log() < rhs.log();
+      }
+      return lhs.tracked() < rhs.tracked();
    } else if(actions_ != other.actions_) {
       return actions_ < other.actions_;
    }
@@ -832,7 +845,7 @@ void
 policy_map_rule_impl_t::mix_me(hash_mix & h) const {
    h.mix(class_map_key_); // class_map_key_t
    h.mix(policy_map_rule_type_); // policy_map_rule_type_t
-   h.mix(raw_rule_); // acl_rule_ip_t
+   h.mix(*raw_rule_); // acl_rule_ip_t
    for (auto it=actions_.cbegin();
         it!=actions_.cend(); ++it) {
       h.mix(*it); // policy_map_action_t
@@ -845,7 +858,7 @@ policy_map_rule_impl_t::to_string() const {
    ss << "policy_map_rule_t(";
    ss << "class_map_key=" << class_map_key_;
    ss << ", policy_map_rule_type=" << policy_map_rule_type_;
-   ss << ", raw_rule=" << raw_rule_;
+   ss << ", raw_rule=" << *raw_rule_;
    ss << ", actions=" <<"'";
    bool first_actions = true;
    for (auto it=actions_.cbegin();
@@ -14,6 +14,7 @@
 #include "eos/intf.h"
 #include "eos/eth.h"
 #include <eos/types/lldp.h>
+#include <eos/lldp_neighbor_info.h>
 
 /**
  * @file
@@ -80,6 +81,18 @@ class EOS_SDK_PUBLIC lldp_handler : public base_handler<lldp_mgr, lldp_handler>
    /// provided below.
    virtual void on_lldp_intf_change(lldp_neighbor_t const & peer);
 
+   /**
+    * Registers this handler for coalesced notifications of neighbor updates.
+    *
+    * Once registered, the handler is notified of each update of a neighbor
+    * with a single on_lldp_neighbor_delta(), instead of one callback per
+    * changed field followed by on_lldp_intf_change(). on_lldp_intf_set() and
+    * on_lldp_intf_del() are still called.
+    */
+   void watch_lldp_neighbor_delta(bool);
+   /// Returns true if this handler is registered for coalesced notifications.
+   bool lldp_neighbor_delta_watched() const;
+
    /*** Handlers called when information about the remote port changes ***/
 
    /* Callbacks for well-known TLVs, the 2 first ones are mandatory TLVs. */
@@ -132,6 +145,15 @@ class EOS_SDK_PUBLIC lldp_handler : public base_handler<lldp_mgr, lldp_handler>
    /// Called when an LLDP interface status change became effective.
    virtual void on_lldp_intf_enabled(intf_id_t intf, lldp_intf_enabled_t status);
 
+   /**
+    * Called once per update of a neighbor, for handlers registered with
+    * watch_lldp_neighbor_delta(). changed_fields is a mask of the
+    * lldp_neighbor_field_t that changed, and neighbor holds all of the
+    * information of the neighbor after the update.
+    */
+   virtual void on_lldp_neighbor_delta(lldp_neighbor_t const & peer,
+                                       uint32_t changed_fields,
+                                       lldp_neighbor_info_t const & neighbor);
 };
 
 
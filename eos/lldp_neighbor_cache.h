@@ -0,0 +1,112 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_LLDP_NEIGHBOR_CACHE_H
+#define EOS_LLDP_NEIGHBOR_CACHE_H
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/lldp.h>
+
+/**
+ * @file
+ * A local cache of the information learned from LLDP neighbors.
+ *
+ * An lldp_neighbor_cache_t reads the information of each neighbor from the
+ * lldp_mgr once, when it changes, and keeps it in a compact encoded form:
+ * the fields describing the remote system (chassis ID, system name and
+ * description, capabilities, management addresses and VLAN) are stored
+ * apart from the fields describing the remote port, and are shared by all
+ * the ports that see the same system. Fields are only decoded when read.
+ *
+ * This suits topology collectors, which read every field of every
+ * neighbor: snapshot() returns all neighbors in one call, without a call
+ * to the lldp_mgr per field and per neighbor.
+ *
+ * @code
+ *    class topology_agent : public eos::agent_handler {
+ *     public:
+ *       explicit topology_agent(eos::sdk & sdk)
+ *             : eos::agent_handler(sdk.get_agent_mgr()),
+ *               neighbors(sdk.get_lldp_mgr()) {
+ *       }
+ *
+ *       void on_initialized() {
+ *          neighbors.resync();
+ *       }
+ *
+ *       void export_topology() {
+ *          for (auto const & info : neighbors.snapshot()) {
+ *             link(info.neighbor().intf(), info.system_name(),
+ *                  info.intf_id().value());
+ *          }
+ *       }
+ *
+ *       eos::lldp_neighbor_cache_t neighbors;
+ *    };
+ * @endcode
+ */
+
+namespace eos {
+
+class lldp_neighbor_cache_internal;
+
+/**
+ * A cache of the LLDP neighbors, by local interface.
+ *
+ * The cache registers itself for coalesced LLDP notifications when
+ * constructed, and stores the information passed to
+ * on_lldp_neighbor_delta(). A neighbor is also read from the lldp_mgr on
+ * on_lldp_intf_change().
+ */
+class EOS_SDK_PUBLIC lldp_neighbor_cache_t : public lldp_handler {
+ public:
+   explicit lldp_neighbor_cache_t(lldp_mgr * mgr);
+   virtual ~lldp_neighbor_cache_t();
+
+   /**
+    * Reloads the cache from the lldp_mgr. Call it once the agent is
+    * initialized, since neighbors learned before the cache was created are
+    * not notified.
+    */
+   void resync();
+   /// Reads the information of a neighbor from the lldp_mgr.
+   void neighbor_update(lldp_neighbor_t const & neighbor);
+   /// Removes all neighbors from the cache.
+   void clear();
+
+   /// Returns the number of neighbors in the cache.
+   size_t size() const;
+   /// Tests for existence of a neighbor.
+   bool exists(lldp_neighbor_t const & neighbor) const;
+   /// Returns a neighbor, or an empty lldp_neighbor_info_t() if unknown.
+   lldp_neighbor_info_t neighbor(lldp_neighbor_t const & neighbor) const;
+   /// Returns the neighbors seen on a local interface.
+   std::vector<lldp_neighbor_info_t> neighbors(intf_id_t intf) const;
+   /// Returns all neighbors, ordered by local interface.
+   std::vector<lldp_neighbor_info_t> snapshot() const;
+   /**
+    * Returns the number of distinct remote systems, whose information is
+    * stored once however many ports see them.
+    */
+   size_t system_count() const;
+
+   virtual void on_lldp_intf_change(lldp_neighbor_t const & peer);
+   virtual void on_lldp_neighbor_delta(lldp_neighbor_t const & peer,
+                                       uint32_t changed_fields,
+                                       lldp_neighbor_info_t const & neighbor);
+   virtual void on_lldp_intf_del(lldp_neighbor_t const & peer);
+
+ private:
+   lldp_neighbor_cache_internal * cache_;
+   EOS_SDK_DISALLOW_COPY_CTOR(lldp_neighbor_cache_t);
+};
+
+}
+
+#endif // EOS_LLDP_NEIGHBOR_CACHE_H
@@ -0,0 +1,104 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_LLDP_NEIGHBOR_INFO_H
+#define EOS_LLDP_NEIGHBOR_INFO_H
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <eos/base.h>
+#include <eos/eth.h>
+#include <eos/types/lldp.h>
+
+/**
+ * @file
+ * The information learned from an LLDP neighbor, as a value.
+ *
+ * An lldp_neighbor_info_t holds all the fields of a neighbor at once. It
+ * is passed to lldp_handler::on_lldp_neighbor_delta() and returned by the
+ * lldp_neighbor_cache_t.
+ */
+
+namespace eos {
+
+class lldp_neighbor_cache_internal;
+class lldp_neighbor_codec;
+
+/**
+ * The fields of the information learned from an LLDP neighbor, as bits of
+ * the mask of changed fields passed to lldp_handler::on_lldp_neighbor_delta().
+ */
+enum lldp_neighbor_field_t {
+   LLDP_NEIGHBOR_CHASSIS_ID = 0x1,
+   LLDP_NEIGHBOR_INTF_ID = 0x2,
+   LLDP_NEIGHBOR_INTF_DESCRIPTION = 0x4,
+   LLDP_NEIGHBOR_SYSTEM_NAME = 0x8,
+   LLDP_NEIGHBOR_SYSTEM_DESCRIPTION = 0x10,
+   LLDP_NEIGHBOR_SYSTEM_CAPABILITIES = 0x20,
+   LLDP_NEIGHBOR_DEFAULT_VLAN = 0x40,
+   LLDP_NEIGHBOR_MANAGEMENT_VLAN = 0x80,
+   LLDP_NEIGHBOR_MAX_FRAME_SIZE = 0x100,
+   LLDP_NEIGHBOR_MANAGEMENT_ADDRESS = 0x200,
+   LLDP_NEIGHBOR_LACP = 0x400,
+   LLDP_NEIGHBOR_PHY = 0x800,
+   /// Any of the organizationally defined TLVs.
+   LLDP_NEIGHBOR_TLVS = 0x1000,
+};
+
+/**
+ * The information learned from an LLDP neighbor.
+ *
+ * Copies share the encoded information, which is decoded by each getter.
+ */
+class EOS_SDK_PUBLIC lldp_neighbor_info_t {
+ public:
+   lldp_neighbor_info_t();
+
+   /// The neighbor, that is the local interface and the remote system.
+   lldp_neighbor_t neighbor() const;
+
+   lldp_chassis_id_t chassis_id() const;
+   lldp_intf_id_t intf_id() const;
+   std::string intf_description() const;
+   std::string system_name() const;
+   std::string system_description() const;
+   lldp_syscap_t system_capabilities() const;
+   vlan_id_t default_vlan() const;
+   vlan_id_t management_vlan() const;
+   uint32_t max_frame_size() const;
+   std::list<lldp_management_address_t> management_address() const;
+   lldp_lacp_t lacp() const;
+   lldp_phy_t phy() const;
+
+   /// Returns the payload of a received organizationally defined TLV.
+   std::string tlv(lldp_tlv_type_t tlv_type) const;
+   /// Tests whether an organizationally defined TLV was received.
+   bool tlv_exists(lldp_tlv_type_t tlv_type) const;
+   /// Returns all the received organizationally defined TLVs.
+   std::map<lldp_tlv_type_t, std::string> tlvs() const;
+
+   /**
+    * Returns the mask of the lldp_neighbor_field_t that differ from a
+    * previous information of the neighbor. Unchanged shared information is
+    * not compared.
+    */
+   uint32_t changed_fields(lldp_neighbor_info_t const & previous) const;
+
+ private:
+   friend class lldp_neighbor_cache_internal;
+   friend class lldp_neighbor_codec;
+   lldp_neighbor_info_t(lldp_neighbor_t const & neighbor,
+                        std::shared_ptr<std::string const> const & system,
+                        std::shared_ptr<std::string const> const & port);
+
+   lldp_neighbor_t neighbor_;
+   std::shared_ptr<std::string const> system_;
+   std::shared_ptr<std::string const> port_;
+};
+
+}
+
+#endif // EOS_LLDP_NEIGHBOR_INFO_H
@@ -0,0 +1,105 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_MAC_MOVE_DETECTOR_H
+#define EOS_MAC_MOVE_DETECTOR_H
+
+#include <utility>
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/mac_table.h>
+
+/**
+ * @file
+ * Detection of MAC move storms.
+ *
+ * A mac_move_detector_t follows the MAC entry notifications of the MAC
+ * table and counts, for each MAC address, how many times it moved between
+ * interfaces over a sliding window of time. When a MAC moves more often
+ * than a threshold within the window, on_mac_move_storm() is called, so
+ * that flapping hosts are found as they flap rather than by polling the
+ * move counters of every entry.
+ *
+ * Memory is bounded: only the MACs moving the most are tracked, using the
+ * "space saving" heavy hitters algorithm. When all of the tracking slots
+ * are in use, the MAC with the fewest moves in the window is replaced. It
+ * is found in logarithmic time in the number of slots, plus one pass over
+ * the slots per eighth of the window, so a flood of new MACs does not cost
+ * a pass over the slots each. The move count of a MAC is then
+ * overestimated by at most the count of the MAC it replaced, which
+ * mac_moves_error() reports; a storm is only raised on the moves a MAC is
+ * known to have made.
+ *
+ * @code
+ *    class flap_detector : public eos::mac_move_detector_t {
+ *     public:
+ *       explicit flap_detector(eos::sdk & sdk)
+ *             // Alert on MACs moving 10 times or more within 30 seconds.
+ *             : eos::mac_move_detector_t(sdk.get_mac_table_mgr(), 1024, 30, 10) {
+ *       }
+ *
+ *       void on_mac_move_storm(eos::mac_key_t const & key, uint32_t moves) {
+ *          // ...
+ *       }
+ *    };
+ * @endcode
+ */
+
+namespace eos {
+
+class mac_move_detector_internal;
+
+/// A MAC move rate tracker, raising alerts on MACs that move too often.
+class EOS_SDK_PUBLIC mac_move_detector_t : public mac_table_handler {
+ public:
+   /**
+    * Creates a detector tracking at most `capacity` MAC addresses, that
+    * calls on_mac_move_storm() when a MAC moves `threshold` times or more
+    * within `window` seconds. The detector registers itself for
+    * notifications of all MAC entries.
+    */
+   mac_move_detector_t(mac_table_mgr * mgr, size_t capacity, seconds_t window,
+                       uint32_t threshold);
+   virtual ~mac_move_detector_t();
+
+   /**
+    * Records a move of a MAC at the given time. Moves are recorded
+    * automatically from MAC entry notifications; this allows feeding moves
+    * observed by other means. Times must not go backwards.
+    */
+   void mac_move_add(mac_key_t const & key, seconds_t when);
+
+   /**
+    * Returns the estimated number of moves of a MAC within the window
+    * ending at the latest move recorded, or 0 if the MAC is not tracked.
+    */
+   uint32_t mac_moves(mac_key_t const & key) const;
+   /// Returns by how much mac_moves() may overestimate the moves of a MAC.
+   uint32_t mac_moves_error(mac_key_t const & key) const;
+   /// Returns true if the MAC is currently over the move threshold.
+   bool mac_move_storm(mac_key_t const & key) const;
+   /**
+    * Returns up to `count` tracked MACs with the most moves within the
+    * window, with their estimated number of moves, most moves first.
+    */
+   std::vector<std::pair<mac_key_t, uint32_t>> mac_top_movers(size_t count) const;
+   /// Forgets all moves recorded.
+   void clear();
+
+   /**
+    * Called when a MAC reaches the move threshold. It is called again for
+    * the same MAC only after its moves fell below the threshold.
+    */
+   virtual void on_mac_move_storm(mac_key_t const & key, uint32_t moves);
+
+   virtual void on_mac_entry_set(mac_entry_t const & entry);
+
+ private:
+   mac_move_detector_internal * detector_;
+   EOS_SDK_DISALLOW_COPY_CTOR(mac_move_detector_t);
+};
+
+}
+
+#endif // EOS_MAC_MOVE_DETECTOR_H
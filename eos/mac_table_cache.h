@@ -0,0 +1,108 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_MAC_TABLE_CACHE_H
+#define EOS_MAC_TABLE_CACHE_H
+
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/mac_table.h>
+
+/**
+ * @file
+ * A local cache of the MAC address table.
+ *
+ * A mac_table_cache_t mirrors the MAC address table of the switch, kept
+ * in sync through mac_table_handler notifications, and indexes it by VLAN
+ * and by interface as well as by key. This answers queries such as "all
+ * MACs on Ethernet3" or "all MACs in VLAN 10" in time proportional to the
+ * number of entries returned, instead of iterating over the whole table.
+ *
+ * The cache also records when each entry moved between interfaces, so
+ * that the entries that moved recently can be listed in the same way.
+ *
+ * @code
+ *    class my_agent : public eos::agent_handler {
+ *     public:
+ *       explicit my_agent(eos::sdk & sdk)
+ *             : eos::agent_handler(sdk.get_agent_mgr()),
+ *               macs(sdk.get_mac_table_mgr()) {
+ *       }
+ *
+ *       void on_initialized() {
+ *          macs.resync();
+ *          for (auto const & entry :
+ *                  macs.mac_entries_by_intf(eos::intf_id_t("Ethernet3"))) {
+ *             // ...
+ *          }
+ *       }
+ *
+ *       eos::mac_table_cache_t macs;
+ *    };
+ * @endcode
+ */
+
+namespace eos {
+
+class mac_table_cache_internal;
+
+/**
+ * A MAC address table cache, indexed by key, VLAN and interface.
+ *
+ * The cache registers itself for notifications of all MAC entries when
+ * constructed. Entries are stored in an open addressing hash table, and
+ * each VLAN and interface keeps the list of its entries, so that adding,
+ * moving or removing an entry takes constant time.
+ */
+class EOS_SDK_PUBLIC mac_table_cache_t : public mac_table_handler {
+ public:
+   explicit mac_table_cache_t(mac_table_mgr * mgr);
+   virtual ~mac_table_cache_t();
+
+   /**
+    * Reloads the cache from the MAC address table status. Call it once the
+    * agent is initialized, since entries learned before the cache was
+    * created are not notified.
+    */
+   void resync();
+   /// Removes all entries from the cache.
+   void clear();
+
+   /// Returns the number of entries in the cache.
+   size_t size() const;
+   /// Tests for existence of an entry with the given key.
+   bool exists(mac_key_t const & key) const;
+   /// Returns the entry with the given key, or an empty mac_entry_t().
+   mac_entry_t mac_entry(mac_key_t const & key) const;
+
+   /// Returns all the entries in a VLAN.
+   std::vector<mac_entry_t> mac_entries_by_vlan(vlan_id_t vlan) const;
+   /// Returns all the entries learned on an interface.
+   std::vector<mac_entry_t> mac_entries_by_intf(intf_id_t intf) const;
+   /// Returns the number of entries in a VLAN.
+   size_t mac_count_by_vlan(vlan_id_t vlan) const;
+   /// Returns the number of entries learned on an interface.
+   size_t mac_count_by_intf(intf_id_t intf) const;
+
+   /// Returns the number of times an entry moved.
+   uint32_t moves(mac_key_t const & key) const;
+   /// Returns the time at which an entry last moved, or 0 if it never did.
+   seconds_t last_move_time(mac_key_t const & key) const;
+   /**
+    * Returns the keys of the entries that moved at or after the given time,
+    * most recent first.
+    */
+   std::vector<mac_key_t> mac_entries_moved_since(seconds_t since) const;
+
+   virtual void on_mac_entry_set(mac_entry_t const & entry);
+   virtual void on_mac_entry_del(mac_key_t const & key);
+
+ private:
+   mac_table_cache_internal * cache_;
+   EOS_SDK_DISALLOW_COPY_CTOR(mac_table_cache_t);
+};
+
+}
+
+#endif // EOS_MAC_TABLE_CACHE_H
@@ -0,0 +1,115 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_MPLS_LABEL_ALLOCATOR_H
+#define EOS_MPLS_LABEL_ALLOCATOR_H
+
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/mpls.h>
+#include <eos/mpls_route.h>
+#include <eos/mpls_vrf_label.h>
+
+/**
+ * @file
+ * Allocation of MPLS labels from configured label ranges.
+ *
+ * The mpls_route_mgr and mpls_vrf_label_mgr take labels chosen by the
+ * agent. An mpls_label_allocator_t hands out labels from the ranges the
+ * agent is configured to use, such as a segment routing block or a
+ * dynamic label range, and tracks which ones are in use.
+ *
+ * Free labels are kept in a bitmap of the whole label space, indexed by a
+ * two-level summary of the words with free labels: allocating the lowest
+ * free label takes constant time. The free labels are also indexed as
+ * runs of consecutive labels by length: a block of labels is taken from
+ * the shortest free run long enough, in logarithmic time in the number of
+ * free runs, and releasing a label merges it with the runs around it, also
+ * in logarithmic time. The index costs a few tens of bytes per free run,
+ * up to a few tens of megabytes when every other label of the label space
+ * is allocated.
+ *
+ * Labels allocated but not programmed are leaks: leaked_labels() compares
+ * the allocated labels with the MPLS routes and VRF labels configured.
+ *
+ * @code
+ *    eos::mpls_label_allocator_t labels;
+ *    labels.range_add(eos::mpls_label_t(100000), eos::mpls_label_t(362143));
+ *
+ *    eos::mpls_label_t label = labels.label_alloc();
+ *    if (!label) {
+ *       // The ranges are exhausted.
+ *    }
+ *    // Eight labels for the adjacency SIDs of a LAN, in a single block.
+ *    eos::mpls_label_t first = labels.label_range_alloc(8);
+ *    // ...
+ *    for (auto leaked : labels.leaked_labels(mpls_route_mgr)) {
+ *       labels.label_free(leaked);
+ *    }
+ * @endcode
+ */
+
+namespace eos {
+
+class mpls_label_allocator_internal;
+
+/// An allocator of MPLS labels.
+class EOS_SDK_PUBLIC mpls_label_allocator_t {
+ public:
+   mpls_label_allocator_t();
+   ~mpls_label_allocator_t();
+
+   /**
+    * Adds the labels from first to last, included, to the labels to
+    * allocate. The reserved labels 0 to 15 are never allocated.
+    */
+   void range_add(mpls_label_t first, mpls_label_t last);
+   /// Returns the number of labels in the ranges.
+   uint32_t size() const;
+   /// Returns the number of labels allocated.
+   uint32_t allocated_count() const;
+
+   /// Allocates the lowest free label, or returns mpls_label_t() if none.
+   mpls_label_t label_alloc();
+   /**
+    * Allocates a block of count consecutive labels, returning the first
+    * one, or mpls_label_t() if there is no such block. The block is taken
+    * from the start of the shortest run of free labels long enough, the
+    * lowest one among the runs of the same length.
+    */
+   mpls_label_t label_range_alloc(uint32_t count);
+   /**
+    * Allocates a given label, such as a label chosen by configuration.
+    * Returns false if the label is not in the ranges or already allocated.
+    */
+   bool label_reserve(mpls_label_t label);
+   /// Releases a label, returning false if it was not allocated.
+   bool label_free(mpls_label_t label);
+   /// Releases a block of count consecutive labels.
+   void label_range_free(mpls_label_t first, uint32_t count);
+   /// Tests whether a label is allocated.
+   bool allocated(mpls_label_t label) const;
+
+   /**
+    * Returns the allocated labels, in increasing order, that are not in the
+    * given list of labels in use.
+    */
+   std::vector<mpls_label_t> leaked_labels(
+         std::vector<mpls_label_t> const & in_use) const;
+   /**
+    * Returns the allocated labels, in increasing order, that are neither
+    * the top label of a configured MPLS route nor a configured VRF label.
+    */
+   std::vector<mpls_label_t> leaked_labels(
+         mpls_route_mgr * route_mgr,
+         mpls_vrf_label_mgr * vrf_label_mgr = 0) const;
+
+ private:
+   mpls_label_allocator_internal * allocator_;
+   EOS_SDK_DISALLOW_COPY_CTOR(mpls_label_allocator_t);
+};
+
+}
+
+#endif // EOS_MPLS_LABEL_ALLOCATOR_H
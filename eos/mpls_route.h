@@ -14,6 +14,8 @@
 namespace eos {
 
 class mpls_route_mgr;
+class mpls_route_batch_t;
+class mpls_route_batch_result_t;
 
 /**
  * The MPLS route handler.
@@ -180,7 +182,7 @@ class EOS_SDK_PUBLIC mpls_route_mgr : public base_mgr<mpls_route_handler,
    /// Removes the MPLS route and all vias matching the route key
    virtual void mpls_route_del(mpls_route_key_t const &) = 0;
 
-   /// Adds a via to an mpls_route_t
+   /// Adds a via to an mpls_route_t. The via is ignored if the route is not set.
    virtual void mpls_route_via_set(mpls_route_via_t const &) = 0;
 
    /**
@@ -198,6 +200,16 @@ class EOS_SDK_PUBLIC mpls_route_mgr : public base_mgr<mpls_route_handler,
     */
    void mpls_route_backup_via_del(mpls_route_via_t const&);
 
+   /**
+    * Inserts or updates a batch of MPLS routes with their vias, in a single
+    * update of the switch configuration, replacing the vias of the routes.
+    * Routes with the same vias share a FEC. The result of each route is
+    * appended to result, in the order of the batch; routes that fail are not
+    * programmed.
+    */
+   void mpls_routes_set(mpls_route_batch_t const & batch,
+                        mpls_route_batch_result_t & result);
+
    /**
     * Legacy method that returns the FEC ID corresponding to the given MPLS label if
     * this route is programmed in hardware, or an empty mpls_fec_id_t otherwise.
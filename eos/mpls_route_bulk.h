@@ -0,0 +1,125 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_MPLS_ROUTE_BULK_H
+#define EOS_MPLS_ROUTE_BULK_H
+
+#include <unordered_map>
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/mpls_route.h>
+
+/**
+ * @file
+ * Bulk MPLS route programming.
+ *
+ * An mpls_route_batch_t holds MPLS routes together with the vias they
+ * forward to, for mpls_route_mgr::mpls_routes_set() to program in a single
+ * call, rather than one mpls_route_set() and one mpls_route_via_set() call
+ * per route and per via.
+ *
+ * The batch stores each distinct set of vias once, however many routes
+ * use it: the labels of an LFIB commonly share a handful of via sets, such
+ * as the ECMP paths towards each neighbor. The routes with the same vias
+ * are programmed to the same FEC, which is reported per route in an
+ * mpls_route_batch_result_t.
+ *
+ * @code
+ *    eos::mpls_route_batch_t batch;
+ *    for (auto const & prefix : prefix_sids) {
+ *       eos::mpls_route_key_t key(prefix.label, 1);
+ *       batch.route_set(eos::mpls_route_t(key), paths_to(prefix.node));
+ *    }
+ *    eos::mpls_route_batch_result_t result;
+ *    mpls_route_mgr->mpls_routes_set(batch, result);
+ *    for (size_t row = 0; row < result.size(); ++row) {
+ *       if (result.result(row) != eos::MPLS_ROUTE_SET_OK) {
+ *          report(result.key(row), result.result(row));
+ *       }
+ *    }
+ * @endcode
+ */
+
+namespace eos {
+
+/// The result of programming a route of a batch.
+enum mpls_route_set_result_t {
+   /// The route and its vias were programmed.
+   MPLS_ROUTE_SET_OK,
+   /// The route key has no label, or an unset label.
+   MPLS_ROUTE_SET_INVALID_KEY,
+   /// A via of the route has no label action.
+   MPLS_ROUTE_SET_INVALID_VIA,
+};
+
+/// A batch of MPLS routes to program, with their vias.
+class EOS_SDK_PUBLIC mpls_route_batch_t {
+ public:
+   mpls_route_batch_t();
+
+   /// Removes all routes and via sets.
+   void clear();
+   /**
+    * Adds a route and the vias it forwards to, replacing any vias the route
+    * had. The route key of the vias is ignored.
+    */
+   void route_set(mpls_route_t const & route,
+                  std::vector<mpls_route_via_t> const & vias);
+
+   /// The number of routes in the batch.
+   size_t size() const;
+   /// The route of a row.
+   mpls_route_t const & route(size_t row) const;
+   /// The index of the via set of the route of a row.
+   size_t via_set_index(size_t row) const;
+
+   /// The number of distinct via sets in the batch.
+   size_t via_set_count() const;
+   /**
+    * The vias of a via set, with an empty route key, in no particular
+    * order.
+    */
+   std::vector<mpls_route_via_t> const & via_set(size_t index) const;
+
+ private:
+   std::vector<mpls_route_t> routes_;
+   std::vector<uint32_t> route_via_sets_;
+   std::vector<std::vector<mpls_route_via_t>> via_sets_;
+   std::unordered_multimap<uint32_t, uint32_t> via_set_index_;
+};
+
+/// The results of programming a batch of MPLS routes, one row per route.
+class EOS_SDK_PUBLIC mpls_route_batch_result_t {
+ public:
+   mpls_route_batch_result_t();
+
+   /// Removes all rows.
+   void clear();
+   /// Appends a row for a route.
+   void result_add(mpls_route_key_t const & key, mpls_route_set_result_t result,
+                   mpls_fec_id_t const & fec);
+
+   /// The number of rows.
+   size_t size() const;
+   /// The key of the route of a row.
+   mpls_route_key_t const & key(size_t row) const;
+   /// The result of programming the route of a row.
+   mpls_route_set_result_t result(size_t row) const;
+   /**
+    * The FEC the route of a row forwards to, or an empty FEC ID if it failed
+    * or has no vias.
+    */
+   mpls_fec_id_t const & fec_id(size_t row) const;
+   /// The number of routes that failed.
+   size_t failed_count() const;
+
+ private:
+   std::vector<mpls_route_key_t> keys_;
+   std::vector<mpls_route_set_result_t> results_;
+   std::vector<mpls_fec_id_t> fecs_;
+};
+
+}
+
+#endif // EOS_MPLS_ROUTE_BULK_H
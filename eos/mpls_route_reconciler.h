@@ -0,0 +1,130 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_MPLS_ROUTE_RECONCILER_H
+#define EOS_MPLS_ROUTE_RECONCILER_H
+
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/mpls_route.h>
+
+/**
+ * @file
+ * Reconciliation of the configured MPLS routes with the routes in hardware.
+ *
+ * An mpls_route_reconciler_t finds the MPLS routes whose hardware state
+ * does not match their configuration: routes configured with vias but not
+ * programmed (missing), routes programmed but not configured (extra), and
+ * routes programmed with other vias than configured (mismatched).
+ *
+ * reconcile() compares all routes at once, joining the configured routes
+ * and the routes in hardware in a single pass over both, sorted by route
+ * key, and records the routes in hardware with their FEC. The reconciler
+ * then keeps this record and its result up to date from the route and FEC
+ * notifications of the mpls_route_mgr, comparing only the routes notified,
+ * so that programming failures are detected as they happen rather than by
+ * periodic full comparisons. A route is programmed when it is in this
+ * record, for reconcile() and route_check() alike, so checking a route
+ * costs a lookup and the comparison of its vias, not a pass over the
+ * routes in hardware. The mpls_route_mgr does not
+ * notify configuration changes: an agent calls route_check() for the routes
+ * it reconfigures.
+ *
+ * A route is missing from the time it is configured until the routing agent
+ * programs it, so an agent typically reports a discrepancy only once it
+ * has lasted for some time, as given by discrepancy_since().
+ *
+ * @code
+ *    class lfib_monitor : public eos::mpls_route_reconciler_t {
+ *     public:
+ *       explicit lfib_monitor(eos::sdk & sdk)
+ *             : eos::mpls_route_reconciler_t(sdk.get_mpls_route_mgr()) {
+ *       }
+ *
+ *       void on_mpls_route_discrepancy(eos::mpls_route_key_t const & key,
+ *                                      eos::mpls_route_discrepancy_t d) {
+ *          if (d == eos::MPLS_ROUTE_DISCREPANCY_NONE) {
+ *             alarm_clear(key);
+ *          } else {
+ *             alarm_arm(key, d, discrepancy_since(key) + 5);
+ *          }
+ *       }
+ *    };
+ * @endcode
+ */
+
+namespace eos {
+
+/// How the hardware state of an MPLS route differs from its configuration.
+enum mpls_route_discrepancy_t {
+   /// The route is programmed as configured, or neither configured nor programmed.
+   MPLS_ROUTE_DISCREPANCY_NONE,
+   /// The route is configured with vias but not programmed.
+   MPLS_ROUTE_DISCREPANCY_MISSING,
+   /// The route is programmed but not configured.
+   MPLS_ROUTE_DISCREPANCY_EXTRA,
+   /// The route is programmed with other vias than configured.
+   MPLS_ROUTE_DISCREPANCY_MISMATCHED,
+};
+
+class mpls_route_reconciler_internal;
+
+/**
+ * A reconciler of the configured MPLS routes with the routes in hardware.
+ *
+ * The reconciler registers itself for all MPLS route notifications when
+ * constructed.
+ */
+class EOS_SDK_PUBLIC mpls_route_reconciler_t : public mpls_route_handler {
+ public:
+   explicit mpls_route_reconciler_t(mpls_route_mgr * mgr);
+   virtual ~mpls_route_reconciler_t();
+
+   /// Compares all the configured routes with all the routes in hardware.
+   void reconcile();
+   /**
+    * Compares a route with its state in hardware, as recorded by the last
+    * reconcile() and the notifications since. Call it after changing the
+    * configuration of the route.
+    */
+   void route_check(mpls_route_key_t const & key);
+   /// Forgets all discrepancies, without notifying them.
+   void clear();
+
+   /// Returns the discrepancy of a route.
+   mpls_route_discrepancy_t discrepancy(mpls_route_key_t const & key) const;
+   /**
+    * Returns the time, as returned by eos::now(), at which the discrepancy of
+    * a route was found, or 0 if it has none.
+    */
+   seconds_t discrepancy_since(mpls_route_key_t const & key) const;
+   /// Returns the number of routes with a discrepancy.
+   size_t discrepancy_count() const;
+   /// Returns the number of routes with a given discrepancy.
+   size_t discrepancy_count(mpls_route_discrepancy_t discrepancy) const;
+   /// Returns the routes with a given discrepancy, sorted by route key.
+   std::vector<mpls_route_key_t> discrepancies(
+         mpls_route_discrepancy_t discrepancy) const;
+
+   /**
+    * Called when the discrepancy of a route changes, with
+    * MPLS_ROUTE_DISCREPANCY_NONE when the route is reconciled.
+    */
+   virtual void on_mpls_route_discrepancy(mpls_route_key_t const & key,
+                                          mpls_route_discrepancy_t discrepancy);
+
+   using mpls_route_handler::on_mpls_route_set;
+   using mpls_route_handler::on_mpls_route_del;
+   virtual void on_mpls_route_set(mpls_route_key_t const & key, mpls_fec_id_t fec);
+   virtual void on_mpls_route_del(mpls_route_key_t const & key);
+   virtual void on_mpls_fec_set(mpls_fec_id_t fec);
+
+ private:
+   mpls_route_reconciler_internal * reconciler_;
+   EOS_SDK_DISALLOW_COPY_CTOR(mpls_route_reconciler_t);
+};
+
+}
+
+#endif // EOS_MPLS_ROUTE_RECONCILER_H
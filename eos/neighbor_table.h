@@ -19,6 +19,8 @@
 #ifndef EOS_NEIGHBOR_TABLE_H
 #define EOS_NEIGHBOR_TABLE_H
 
+#include <vector>
+
 #include <eos/eth.h>
 #include <eos/base_handler.h>
 #include <eos/intf.h>
@@ -105,6 +107,27 @@ class EOS_SDK_PUBLIC neighbor_table_mgr : public base_mgr<neighbor_table_handler
  public:
    virtual ~neighbor_table_mgr();
 
+   /**
+    * Resync mediates the static neighbor configuration into a known good
+    * state.
+    *
+    * To start a resync, call resync_init() and then set the static entries
+    * as normal, with neighbor_entry_set() or neighbor_entries_set(). After
+    * all entries have been set, call resync_complete(), which deletes the
+    * static entries that were not set during the resync.
+    *
+    * The entries set during the resync are compared, by hash, with the
+    * configuration in place when resync_complete() is called: entries set
+    * unchanged are left alone, so that a restarting agent can reconcile
+    * a large table without deleting and re-adding every entry. During the
+    * resync, neighbor_entry() and the deletion functions act only on the
+    * entries set since resync_init(); iteration traverses the configuration
+    * in place.
+    */
+   void resync_init();
+   /// Completes any underway resync operation.
+   void resync_complete();
+
    /**
     * Iterates through the statically configured ARP and Neighbor Discovery tables in
     * the default VRF.
@@ -144,6 +167,14 @@ class EOS_SDK_PUBLIC neighbor_table_mgr : public base_mgr<neighbor_table_handler
     */
    virtual void neighbor_entry_del(neighbor_key_t const & key) = 0;
 
+   /**
+    * Configures a batch of static entries. Entries already configured the
+    * same way are left alone.
+    */
+   void neighbor_entries_set(std::vector<neighbor_entry_t> const &);
+   /// Deletes a batch of static entries.
+   void neighbor_entries_del(std::vector<neighbor_key_t> const &);
+
    /// Looks up a configured neighbor entry for a given L3 interface and IP address.
    virtual neighbor_entry_t neighbor_entry(neighbor_key_t const & key) const = 0;
 
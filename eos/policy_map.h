@@ -110,6 +110,8 @@ struct EOS_SDK_PUBLIC hash<eos::policy_map_key_t> {
 
 namespace eos {
 
+class traffic_policy_counter_snapshot_t;
+
 class policy_map_iter_impl;
 class policy_map_hw_status_iter_impl;
 //class policy_map_hw_status_iter_t; 
@@ -239,9 +241,54 @@ class EOS_SDK_PUBLIC policy_map_mgr : public base_mgr<policy_map_handler,
    virtual bool exists(policy_map_key_t const & key) const = 0;
 
    virtual policy_map_t policy_map(policy_map_key_t const & key) const = 0;
+   /**
+    * Configures a policy map, replacing any existing one with the same key.
+    *
+    * The policy map is compared with the version currently configured and
+    * only the rules that differ are pushed, so setting an unchanged policy
+    * map is a no op. Any rule changes staged on the policy map with
+    * policy_map_rule_set() or policy_map_rule_del() are discarded.
+    */
    virtual void policy_map_is(policy_map_t const & policy_map) = 0;
    virtual void policy_map_del(policy_map_key_t const & key) = 0;
 
+   /**
+    * Sets the rule at the given sequence number of a policy map.
+    *
+    * The change is staged, and only takes effect once policy_map_commit()
+    * is called. If the policy map doesn't exist, it is created on commit.
+    */
+   void policy_map_rule_set(policy_map_key_t const &, uint32_t,
+                            policy_map_rule_t const &);
+
+   /**
+    * Removes the rule at the given sequence number of a policy map.
+    *
+    * The change is staged, and only takes effect once policy_map_commit()
+    * is called. If there is no rule at the sequence number, that is a no op.
+    */
+   void policy_map_rule_del(policy_map_key_t const &, uint32_t);
+
+   /**
+    * Commits the rule changes staged on all policy maps.
+    *
+    * Each policy map is compared with the version last committed, and only
+    * the rules that differ are pushed. Notifications are batched: once all
+    * of the policy maps are updated, handlers get a single
+    * on_policy_map_sync() for each policy map that changed, and the hardware
+    * status of each of those policy maps is updated at once, rather than
+    * once per rule.
+    */
+   void policy_map_commit();
+
+   /**
+    * Returns the number of rules of a policy map with changes pending commit.
+    *
+    * Setting a rule to the value it was last committed with does not count
+    * as a change.
+    */
+   uint32_t policy_map_pending_rule_count(policy_map_key_t const &) const;
+
    /**
     * Provides iteration over the configured policy maps for a feature.
     */
@@ -288,6 +335,22 @@ class EOS_SDK_PUBLIC policy_map_mgr : public base_mgr<policy_map_handler,
    virtual void traffic_policy_apply(std::string const &, intf_id_t,
                                      traffic_policy_direction_t, bool apply) = 0;
 
+   /**
+    * Returns the counters of a traffic policy.
+    */
+   traffic_policy_counter_t traffic_policy_counter(
+         std::string const & tpName) const;
+
+   /**
+    * Reads the counters of all traffic policies into a snapshot.
+    *
+    * The snapshot is cleared first, then filled with one row per counter of
+    * every traffic policy and stamped with the current time. Reusing the
+    * same snapshot between calls avoids reallocating its columns. See
+    * traffic_policy_counter_snapshot_t::delta() to compute rates.
+    */
+   void traffic_policy_counters(traffic_policy_counter_snapshot_t &) const;
+
  protected:
    policy_map_mgr() EOS_SDK_PRIVATE;
    friend class policy_map_handler;
@@ -0,0 +1,169 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_SBFD_RTT_AGGREGATOR_H
+#define EOS_SBFD_RTT_AGGREGATOR_H
+
+#include <utility>
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/bfd.h>
+
+/**
+ * @file
+ * Aggregation of sBFD echo session round-trip times.
+ *
+ * An sbfd_rtt_aggregator_t follows the RTT reports of all sBFD echo
+ * sessions with RTT statistics enabled, and keeps for each session a
+ * histogram of its RTTs from which percentiles are read, along with its
+ * jitter. All sessions can be read in one call, and on_sbfd_rtt_threshold()
+ * is called when a session goes over or back under the configured
+ * thresholds, so that SLA monitoring needs no bookkeeping per report.
+ *
+ * Each RTT report is recorded as one sample: the average RTT since the
+ * previous report. The minimum and maximum RTTs are those reported.
+ *
+ * Statistics follow the recent RTTs: samples are recorded in windows of
+ * rtt_window() seconds, and the statistics cover the current window and
+ * the previous one, so between one and two windows of samples. Older
+ * samples are forgotten as the windows rotate.
+ *
+ * Histograms have a logarithmic scale with 32 to 64 linear sub-buckets per
+ * power of two, as in HDR histograms: percentiles are reported with a
+ * precision of about 3%, using a fixed amount of memory per session for
+ * RTTs up to the full range of sbfd_echo_session_rtt_stats_t.
+ *
+ * @code
+ *    class sla_monitor : public eos::sbfd_rtt_aggregator_t {
+ *     public:
+ *       explicit sla_monitor(eos::sdk & sdk)
+ *             : eos::sbfd_rtt_aggregator_t(sdk.get_bfd_session_mgr()) {
+ *          // Alert on a p99 RTT over 5ms, or a jitter over 1ms.
+ *          rtt_threshold_is(5000, 1000);
+ *       }
+ *
+ *       void on_sbfd_rtt_threshold(eos::sbfd_echo_session_key_t const & key,
+ *                                  eos::sbfd_rtt_summary_t const & summary,
+ *                                  bool exceeded) {
+ *          // ...
+ *       }
+ *    };
+ * @endcode
+ */
+
+namespace eos {
+
+/// The RTT statistics of an sBFD echo session, in microseconds.
+class EOS_SDK_PUBLIC sbfd_rtt_summary_t {
+ public:
+   sbfd_rtt_summary_t();
+   sbfd_rtt_summary_t(uint64_t samples, uint32_t min_rtt, uint32_t max_rtt,
+                      uint32_t p50_rtt, uint32_t p99_rtt, uint32_t p999_rtt,
+                      uint32_t jitter);
+
+   /// The number of RTT samples recorded.
+   uint64_t samples() const;
+   /// The minimum RTT.
+   uint32_t min_rtt() const;
+   /// The maximum RTT.
+   uint32_t max_rtt() const;
+   /// The median RTT.
+   uint32_t p50_rtt() const;
+   /// The 99th percentile RTT.
+   uint32_t p99_rtt() const;
+   /// The 99.9th percentile RTT.
+   uint32_t p999_rtt() const;
+   /// The jitter: the mean deviation between consecutive samples.
+   uint32_t jitter() const;
+
+ private:
+   uint64_t samples_;
+   uint32_t min_rtt_;
+   uint32_t max_rtt_;
+   uint32_t p50_rtt_;
+   uint32_t p99_rtt_;
+   uint32_t p999_rtt_;
+   uint32_t jitter_;
+};
+
+class sbfd_rtt_aggregator_internal;
+
+/// An aggregator of the RTTs of sBFD echo sessions.
+class EOS_SDK_PUBLIC sbfd_rtt_aggregator_t : public bfd_session_handler {
+ public:
+   /**
+    * Creates an aggregator, which registers itself for notifications of
+    * all sBFD echo sessions. RTTs are only reported for the sessions with
+    * RTT statistics enabled by bfd_session_mgr::sbfd_echo_rtt_enabled_set().
+    */
+   explicit sbfd_rtt_aggregator_t(bfd_session_mgr * mgr);
+   virtual ~sbfd_rtt_aggregator_t();
+
+   /**
+    * Records an RTT sample of a session, in microseconds. Samples are
+    * recorded automatically from RTT reports; this allows feeding RTTs
+    * measured by other means.
+    */
+   void rtt_add(sbfd_echo_session_key_t const & key, uint32_t rtt);
+
+   /// Returns the RTT statistics of a session, with no samples if unknown.
+   sbfd_rtt_summary_t rtt_summary(sbfd_echo_session_key_t const & key) const;
+   /// Returns the RTT statistics of all sessions with samples.
+   std::vector<std::pair<sbfd_echo_session_key_t, sbfd_rtt_summary_t>>
+      rtt_summaries() const;
+   /**
+    * Returns the RTT of a session at the given percentile, between 0 and
+    * 100, or 0 if the session has no samples.
+    */
+   uint32_t rtt_percentile(sbfd_echo_session_key_t const & key,
+                           double percentile) const;
+
+   /**
+    * Sets the thresholds of the p99 RTT and of the jitter, in
+    * microseconds, over which on_sbfd_rtt_threshold() is called. A
+    * threshold of 0 is disabled, which is the default.
+    */
+   void rtt_threshold_is(uint32_t p99_rtt, uint32_t jitter);
+
+   /**
+    * Sets the length of the windows of samples, in seconds: 60 by default.
+    * A window of 0 never ends, so that the statistics cover all the
+    * samples recorded.
+    */
+   void rtt_window_is(seconds_t window);
+   /// Returns the length of the windows of samples, in seconds.
+   seconds_t rtt_window() const;
+
+   /// Forgets the samples of a session.
+   void rtt_reset(sbfd_echo_session_key_t const & key);
+   /// Forgets the samples of all sessions.
+   void clear();
+
+   /**
+    * Called when the p99 RTT or the jitter of a session goes over its
+    * threshold, with exceeded true, and when both are back under their
+    * thresholds, with exceeded false.
+    */
+   virtual void on_sbfd_rtt_threshold(sbfd_echo_session_key_t const & key,
+                                      sbfd_rtt_summary_t const & summary,
+                                      bool exceeded);
+
+   virtual void on_sbfd_echo_session_rtt(sbfd_echo_session_key_t const & key,
+                                         sbfd_echo_session_rtt_stats_t const &
+                                         stats);
+   virtual void on_sbfd_echo_session_del(sbfd_echo_session_key_t const & key);
+
+ private:
+   void sample_add(sbfd_echo_session_key_t const & key, uint32_t rtt,
+                   uint32_t min, uint32_t max);
+
+   sbfd_rtt_aggregator_internal * aggregator_;
+   EOS_SDK_DISALLOW_COPY_CTOR(sbfd_rtt_aggregator_t);
+};
+
+}
+
+#include <eos/inline/sbfd_rtt_aggregator.h>
+
+#endif // EOS_SBFD_RTT_AGGREGATOR_H
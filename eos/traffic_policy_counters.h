@@ -0,0 +1,153 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_TRAFFIC_POLICY_COUNTERS_H
+#define EOS_TRAFFIC_POLICY_COUNTERS_H
+
+#include <string>
+#include <vector>
+
+#include <eos/base.h>
+#include <eos/policy_map.h>
+
+/**
+ * @file
+ * Bulk traffic policy counters.
+ *
+ * A traffic_policy_counter_snapshot_t holds the counters of every traffic
+ * policy at one point in time, as returned by
+ * policy_map_mgr::traffic_policy_counters(). Counters are stored as one
+ * row per (traffic policy, counter) pair, with each statistic in its own
+ * contiguous column, so that thousands of rules can be exported without
+ * building a traffic_policy_counter_t per policy.
+ *
+ * Subtracting two snapshots yields a traffic_policy_counter_delta_t,
+ * holding the increase and the per-second rate of every counter over the
+ * interval between them. The computation runs over whole columns at once.
+ *
+ * @code
+ *    eos::traffic_policy_counter_snapshot_t previous, current;
+ *    eos::traffic_policy_counter_delta_t delta;
+ *    policy_map_mgr->traffic_policy_counters(previous);
+ *    // ... one second later:
+ *    policy_map_mgr->traffic_policy_counters(current);
+ *    current.delta(previous, delta);
+ *    for (size_t row = 0; row < current.size(); ++row) {
+ *       export(current.policy(row), current.counter_name(row),
+ *              delta.pkt_hit_rates()[row]);
+ *    }
+ *    std::swap(previous, current);
+ * @endcode
+ */
+
+namespace eos {
+
+class traffic_policy_counter_delta_t;
+
+/// The counters of all traffic policies at one point in time.
+class EOS_SDK_PUBLIC traffic_policy_counter_snapshot_t {
+ public:
+   traffic_policy_counter_snapshot_t();
+
+   /// Removes all rows, keeping the allocated columns for reuse.
+   void clear();
+   /// Appends a row for every named and class counter of a traffic policy.
+   void counter_add(traffic_policy_counter_t const & counter);
+
+   /// The time at which the counters were read, as returned by eos::now().
+   seconds_t timestamp() const;
+   void timestamp_is(seconds_t timestamp);
+
+   /// The number of rows in the snapshot.
+   size_t size() const;
+   /// The name of the traffic policy a row belongs to.
+   std::string const & policy(size_t row) const;
+   /// The name of the counter of a row.
+   std::string const & counter_name(size_t row) const;
+   /// Returns true if a row is a class counter rather than a named counter.
+   bool class_counter(size_t row) const;
+   /// Returns a row as a traffic_policy_counter_data_t.
+   traffic_policy_counter_data_t counter_data(size_t row) const;
+
+   /// The packet hits of every row.
+   uint64_t const * pkt_hits() const;
+   /// The byte hits of every row.
+   uint64_t const * byte_hits() const;
+   /// The packet drops of every row.
+   uint64_t const * pkt_drops() const;
+   /// The byte drops of every row.
+   uint64_t const * byte_drops() const;
+
+   /**
+    * Computes how much every counter grew since an earlier snapshot.
+    *
+    * The rows of the delta are those of this snapshot. A row with no
+    * match in the previous snapshot, or whose counter went backwards
+    * (e.g. the counters were cleared), counts from zero. Rates are per
+    * second over the interval between the two timestamps, and are zero
+    * if the interval is not positive.
+    */
+   void delta(traffic_policy_counter_snapshot_t const & previous,
+              traffic_policy_counter_delta_t & delta) const;
+
+ private:
+   void row_add(uint32_t policy, std::string const & name, bool class_counter,
+                traffic_policy_counter_data_t const & data);
+   bool same_rows(traffic_policy_counter_snapshot_t const & other) const;
+
+   seconds_t timestamp_;
+   std::vector<std::string> policies_;
+   std::vector<uint32_t> policy_index_;
+   std::vector<std::string> counter_names_;
+   std::vector<uint8_t> class_counter_;
+   std::vector<uint64_t> pkt_hits_;
+   std::vector<uint64_t> byte_hits_;
+   std::vector<uint64_t> pkt_drops_;
+   std::vector<uint64_t> byte_drops_;
+};
+
+/**
+ * The change of every traffic policy counter between two snapshots.
+ *
+ * Rows are those of the later snapshot it was computed from.
+ */
+class EOS_SDK_PUBLIC traffic_policy_counter_delta_t {
+ public:
+   traffic_policy_counter_delta_t();
+
+   /// The number of rows.
+   size_t size() const;
+   /// The number of seconds between the two snapshots.
+   seconds_t interval() const;
+
+   uint64_t const * pkt_hits() const;
+   uint64_t const * byte_hits() const;
+   uint64_t const * pkt_drops() const;
+   uint64_t const * byte_drops() const;
+
+   /// The packet hits per second of every row.
+   double const * pkt_hit_rates() const;
+   /// The byte hits per second of every row.
+   double const * byte_hit_rates() const;
+   /// The packet drops per second of every row.
+   double const * pkt_drop_rates() const;
+   /// The byte drops per second of every row.
+   double const * byte_drop_rates() const;
+
+ private:
+   friend class traffic_policy_counter_snapshot_t;
+
+   seconds_t interval_;
+   std::vector<uint64_t> pkt_hits_;
+   std::vector<uint64_t> byte_hits_;
+   std::vector<uint64_t> pkt_drops_;
+   std::vector<uint64_t> byte_drops_;
+   std::vector<double> pkt_hit_rates_;
+   std::vector<double> byte_hit_rates_;
+   std::vector<double> pkt_drop_rates_;
+   std::vector<double> byte_drop_rates_;
+};
+
+}
+
+#endif // EOS_TRAFFIC_POLICY_COUNTERS_H
@@ -11,6 +11,8 @@
 #include <list>
 #include <memory>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #ifdef SWIG
 %ignore eos::acl_ttl_spec_t(eos::acl_ttl_spec_t &&) noexcept;
@@ -177,6 +179,74 @@ class EOS_SDK_PUBLIC acl_ttl_spec_t {
 EOS_SDK_PUBLIC
 std::ostream& operator<<(std::ostream& os, const acl_ttl_spec_t& obj);
 
+/**
+ * A set of TCP or UDP ports, stored as sorted, disjoint, inclusive ranges.
+ *
+ * Membership tests are a binary search over the ranges. Sets made of many
+ * ranges that are close together also maintain a bitmap of the ports from
+ * their first to their last one, so that testing a port stays constant
+ * time however fragmented the set is. The bitmap takes at most a word per
+ * range, and is patched in place with word masks as ranges are set and
+ * deleted.
+ */
+class EOS_SDK_PUBLIC acl_port_range_set_t {
+ public:
+   /** Default constructor, an empty set. */
+   acl_port_range_set_t();
+
+   /** Returns true if no port is in the set. */
+   bool empty() const;
+   /** The ranges making up the set, in increasing order. */
+   std::vector<std::pair<uint16_t, uint16_t>> const & ranges() const;
+   /**
+    * Replaces the set with the union of the given ranges, in any order.
+    * This builds the set in one pass, where adding ranges one by one costs a
+    * shift of the ranges each.
+    */
+   void ranges_is(std::vector<std::pair<uint16_t, uint16_t>> const & ranges);
+   void ranges_is(std::vector<std::pair<uint16_t, uint16_t>> && ranges);
+   /** Adds the ports from low to high (inclusive) to the set. */
+   void range_set(uint16_t low, uint16_t high);
+   /** Removes the ports from low to high (inclusive) from the set. */
+   void range_del(uint16_t low, uint16_t high);
+   /** Removes all ports from the set. */
+   void clear();
+   /** Returns true if the given port is in the set. */
+   bool contains(uint16_t port) const;
+
+   bool operator==(acl_port_range_set_t const & other) const;
+   bool operator!=(acl_port_range_set_t const & other) const;
+   /** The hash function for type acl_port_range_set_t. */
+   uint32_t hash() const;
+   /** The hash mix function for type acl_port_range_set_t. */
+   void mix_me(hash_mix & h) const;
+   /** Returns a string representation of the current object's values. */
+   std::string to_string() const;
+   /**
+    * A utility stream operator that adds a string representation of
+    * acl_port_range_set_t to the ostream.
+    */
+   friend std::ostream& operator<<(std::ostream& os,
+                                   const acl_port_range_set_t& obj);
+
+ private:
+   void ranges_normalize();
+   bool bitmap_wanted() const;
+   void bitmap_build();
+   void bitmap_update(uint16_t low, uint16_t high, bool set);
+   void bitmap_fill(uint16_t low, uint16_t high, bool set);
+
+   std::vector<std::pair<uint16_t, uint16_t>> ranges_;
+   // One bit per port from the word bitmap_base_ on, only populated for sets
+   // of many ranges close together.
+   uint32_t bitmap_base_;
+   std::vector<uint64_t> bitmap_;
+};
+
+EOS_SDK_PUBLIC
+std::ostream& operator<<(std::ostream& os, const acl_port_range_set_t& obj);
+
+
 class acl_port_spec_impl_t;
 /**
  * A UDP or TCP port specifier.
@@ -193,6 +263,10 @@ class EOS_SDK_PUBLIC acl_port_spec_t {
    /** Default constructor, matches any port. */
    acl_port_spec_t();
    acl_port_spec_t(acl_range_operator_t oper, std::list<uint16_t> const & ports);
+   /** Constructor for an EQ, NEQ, LT or GT specifier on a single port. */
+   acl_port_spec_t(acl_range_operator_t oper, uint16_t port);
+   /** Constructor for a BETWEEN specifier, matching ports low to high. */
+   acl_port_spec_t(acl_range_operator_t oper, uint16_t low, uint16_t high);
    acl_port_spec_t(const acl_port_spec_t& other);
    acl_port_spec_t& operator=(
       acl_port_spec_t const & other);
@@ -208,6 +282,13 @@ class EOS_SDK_PUBLIC acl_port_spec_t {
    acl_range_operator_t oper() const;
    void oper_is(acl_range_operator_t oper);
 
+   /**
+    * Getter for 'ports': the operands of the range operator.
+    *
+    * The ports are stored in a compact array; this list is a compatibility
+    * view built on first access after a change. Prefer port_ranges() or
+    * port_match() to evaluate the specifier.
+    */
    std::list<uint16_t> const & ports() const;
    void ports_is(std::list<uint16_t> const & ports);
    void ports_is(std::list<uint16_t> && ports);
@@ -218,6 +299,11 @@ class EOS_SDK_PUBLIC acl_port_spec_t {
    /** Remove all matching port elements. */
    void port_del(uint16_t const & ports);
 
+   /** Getter for 'port_ranges': the set of ports matched by this specifier. */
+   acl_port_range_set_t const & port_ranges() const;
+   /** Returns true if this specifier matches the given port. */
+   bool port_match(uint16_t port) const;
+
    bool operator==(acl_port_spec_t const & other) const;
    bool operator!=(acl_port_spec_t const & other) const;
    bool operator<(acl_port_spec_t const & other) const;
@@ -496,6 +582,14 @@ class EOS_SDK_PUBLIC acl_rule_ip_t : public acl_rule_base_t {
 EOS_SDK_PUBLIC
 std::ostream& operator<<(std::ostream& os, const acl_rule_ip_t& obj);
 
+/**
+ * Returns true if two IP rules are identical. Unlike acl_rule_ip_t::operator==,
+ * this also compares the fields inherited from acl_rule_base_t, such as the
+ * action.
+ */
+EOS_SDK_PUBLIC
+bool acl_rule_ip_equal(acl_rule_ip_t const & a, acl_rule_ip_t const & b);
+
 class acl_rule_eth_impl_t;
 /** An Ethernet ACL, which can be applied to Ethernet, Vlan, and MLAG interfaces. */
 class EOS_SDK_PUBLIC acl_rule_eth_t : public acl_rule_base_t {
@@ -11,6 +11,7 @@
 #include <list>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 namespace eos {
 
@@ -70,6 +71,8 @@ class EOS_SDK_PUBLIC acl_port_spec_impl_t {
    acl_port_spec_impl_t();
    acl_port_spec_impl_t(acl_range_operator_t oper,
                         std::list<uint16_t> const & ports);
+   acl_port_spec_impl_t(acl_range_operator_t oper, uint16_t port);
+   acl_port_spec_impl_t(acl_range_operator_t oper, uint16_t low, uint16_t high);
 
    acl_range_operator_t oper() const;
    void oper_is(acl_range_operator_t oper);
@@ -84,6 +87,11 @@ class EOS_SDK_PUBLIC acl_port_spec_impl_t {
    /** Remove all matching port elements. */
    void port_del(uint16_t const & ports);
 
+   /** Getter for 'port_ranges': the set of ports matched by this specifier. */
+   acl_port_range_set_t const & port_ranges() const;
+   /** Returns true if this specifier matches the given port. */
+   bool port_match(uint16_t port) const;
+
    bool operator==(acl_port_spec_impl_t const & other) const;
    bool operator!=(acl_port_spec_impl_t const & other) const;
    bool operator<(acl_port_spec_impl_t const & other) const;
@@ -101,8 +109,14 @@ class EOS_SDK_PUBLIC acl_port_spec_impl_t {
                                    const acl_port_spec_impl_t& obj);
 
  private:
+   /** Updates port_ranges_ after a port is added. */
+   void port_added(uint16_t port);
+   /** Recomputes port_ranges_ from the operator and the ports. */
+   void ports_changed();
+
    acl_range_operator_t oper_;
    std::list<uint16_t> ports_;
+   acl_port_range_set_t port_ranges_;
 };
 
 
@@ -8,8 +8,10 @@
 #include <eos/ip.h>
 #include <eos/utility.h>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <unordered_set>
+#include <vector>
 
 #ifdef SWIG
 %ignore eos::bgp_path_attr_fields_t(eos::bgp_path_attr_fields_t &&) noexcept;
@@ -19,6 +21,19 @@
 %ignore eos::bgp_path_options_t::operator=(eos::bgp_path_options_t &&) noexcept;
 %ignore eos::bgp_path_options_t::path_attr_fields_is(
          eos::bgp_path_attr_fields_t &&);
+%ignore eos::bgp_path_options_t::prefixes_is(
+         std::set<eos::ip_prefix_t> &&);
+%ignore eos::bgp_path_options_t::prefix_set(eos::ip_prefix_t &&);
+%ignore eos::bgp_path_options_t::peer_addrs_is(
+         std::unordered_set<eos::ip_addr_t> &&);
+%ignore eos::bgp_path_options_t::peer_addr_set(eos::ip_addr_t &&);
+%ignore eos::bgp_path_options_t::communities_is(
+         std::unordered_set<uint32_t> &&);
+%ignore eos::bgp_path_options_t::community_set(uint32_t &&);
+%ignore eos::bgp_path_options_t::next_hops_is(
+         std::unordered_set<eos::ip_addr_t> &&);
+%ignore eos::bgp_path_options_t::next_hop_set(eos::ip_addr_t &&);
+%ignore eos::bgp_path_options_t::page_token_is(std::string &&);
 %ignore eos::bgp_path_attr_t(eos::bgp_path_attr_t &&) noexcept;
 %ignore eos::bgp_path_attr_t::operator=(eos::bgp_path_attr_t &&) noexcept;
 %ignore eos::bgp_path_attr_t::next_hop_is(eos::ip_addr_t &&);
@@ -33,6 +48,9 @@
 %ignore eos::bgp_path_t::operator=(eos::bgp_path_t &&) noexcept;
 %ignore eos::bgp_path_t::path_key_is(eos::bgp_path_key_t &&);
 %ignore eos::bgp_path_t::path_attr_is(eos::bgp_path_attr_t &&);
+%ignore eos::bgp_path_change_t(eos::bgp_path_change_t &&) noexcept;
+%ignore eos::bgp_path_change_t::operator=(eos::bgp_path_change_t &&) noexcept;
+%ignore eos::bgp_path_change_t::path_is(eos::bgp_path_t &&);
 #endif
 
 namespace eos {
@@ -58,6 +76,19 @@ enum bgp_receive_route_stage_t {
 EOS_SDK_PUBLIC std::ostream& operator<<(std::ostream& os,
                                         const bgp_receive_route_stage_t & enum_val);
 
+/** The kind of change made to a BGP path. */
+enum bgp_path_change_type_t {
+   BGP_PATH_ADDED,
+   BGP_PATH_UPDATED,
+   BGP_PATH_DELETED,
+};
+/**
+ * Appends a string representation of enum bgp_path_change_type_t value to the
+ * ostream.
+ */
+EOS_SDK_PUBLIC std::ostream& operator<<(std::ostream& os,
+                                        const bgp_path_change_type_t & enum_val);
+
 class bgp_path_attr_fields_impl_t;
 /** The BGP path option to enable lookup of additional path attributes fields. */
 class EOS_SDK_PUBLIC bgp_path_attr_fields_t {
@@ -152,6 +183,90 @@ class EOS_SDK_PUBLIC bgp_path_options_t {
    /** Moving Setter for 'path_attr_fields'. */
    void path_attr_fields_is(bgp_path_attr_fields_t && path_attr_fields);
 
+   /**
+    * Getter for 'prefixes': Restricts the lookup to the paths of these
+    * prefixes and of the more specific prefixes they contain. The paths of all
+    * prefixes are looked up if empty.
+    */
+   std::set<ip_prefix_t> const & prefixes() const;
+   /** Setter for 'prefixes'. */
+   void prefixes_is(std::set<ip_prefix_t> const & prefixes);
+   /** Moving Setter for 'prefixes'. */
+   void prefixes_is(std::set<ip_prefix_t> && prefixes);
+   /** Inserts one prefix of 'value' to the set. */
+   void prefix_set(ip_prefix_t const & value);
+   /** Inserts one prefix of 'value' to the set. */
+   void prefix_set(ip_prefix_t && value);
+   /** Deletes one prefix of 'value' from the set. */
+   void prefix_del(ip_prefix_t const & value);
+
+   /**
+    * Getter for 'peer_addrs': Restricts the lookup to the paths received
+    * from these peers. The paths of all peers are looked up if empty.
+    */
+   std::unordered_set<ip_addr_t> const & peer_addrs() const;
+   /** Setter for 'peer_addrs'. */
+   void peer_addrs_is(std::unordered_set<ip_addr_t> const & peer_addrs);
+   /** Moving Setter for 'peer_addrs'. */
+   void peer_addrs_is(std::unordered_set<ip_addr_t> && peer_addrs);
+   /** Inserts one peer_addr of 'value' to the set. */
+   void peer_addr_set(ip_addr_t const & value);
+   /** Inserts one peer_addr of 'value' to the set. */
+   void peer_addr_set(ip_addr_t && value);
+   /** Deletes one peer_addr of 'value' from the set. */
+   void peer_addr_del(ip_addr_t const & value);
+
+   /**
+    * Getter for 'communities': Restricts the lookup to the paths carrying
+    * at least one of these communities. No path is excluded if empty.
+    */
+   std::unordered_set<uint32_t> const & communities() const;
+   /** Setter for 'communities'. */
+   void communities_is(std::unordered_set<uint32_t> const & communities);
+   /** Moving Setter for 'communities'. */
+   void communities_is(std::unordered_set<uint32_t> && communities);
+   /** Inserts one community of 'value' to the set. */
+   void community_set(uint32_t const & value);
+   /** Inserts one community of 'value' to the set. */
+   void community_set(uint32_t && value);
+   /** Deletes one community of 'value' from the set. */
+   void community_del(uint32_t const & value);
+
+   /**
+    * Getter for 'next_hops': Restricts the lookup to the paths with one of
+    * these next hops. No path is excluded if empty.
+    */
+   std::unordered_set<ip_addr_t> const & next_hops() const;
+   /** Setter for 'next_hops'. */
+   void next_hops_is(std::unordered_set<ip_addr_t> const & next_hops);
+   /** Moving Setter for 'next_hops'. */
+   void next_hops_is(std::unordered_set<ip_addr_t> && next_hops);
+   /** Inserts one next_hop of 'value' to the set. */
+   void next_hop_set(ip_addr_t const & value);
+   /** Inserts one next_hop of 'value' to the set. */
+   void next_hop_set(ip_addr_t && value);
+   /** Deletes one next_hop of 'value' from the set. */
+   void next_hop_del(ip_addr_t const & value);
+
+   /**
+    * Getter for 'page_size': The maximum number of paths returned by a
+    * paged lookup, or 0 for no limit.
+    */
+   uint32_t page_size() const;
+   /** Setter for 'page_size'. */
+   void page_size_is(uint32_t page_size);
+
+   /**
+    * Getter for 'page_token': Where a paged lookup resumes: empty to
+    * start from the first path, or the token left by the previous lookup.
+    * Paged lookups update it, and clear it once the last path is returned.
+    */
+   std::string page_token() const;
+   /** Setter for 'page_token'. */
+   void page_token_is(std::string const & page_token);
+   /** Moving Setter for 'page_token'. */
+   void page_token_is(std::string && page_token);
+
    bool operator==(bgp_path_options_t const & other) const;
    bool operator!=(bgp_path_options_t const & other) const;
    /** The hash function for type bgp_path_options_t. */
@@ -174,7 +289,12 @@ EOS_SDK_PUBLIC
 std::ostream& operator<<(std::ostream& os, const bgp_path_options_t& obj);
 
 class bgp_path_attr_impl_t;
-/** The BGP path attribute entry. */
+/**
+ * The BGP path attribute entry.
+ *
+ * Community lists are kept sorted and shared: all the attributes with the
+ * same communities refer to a single copy of the list.
+ */
 class EOS_SDK_PUBLIC bgp_path_attr_t {
  public:
    bgp_path_attr_t();
@@ -213,18 +333,35 @@ class EOS_SDK_PUBLIC bgp_path_attr_t {
    /** Setter for 'local_pref'. */
    void local_pref_is(uint32_t local_pref);
 
-   /** Getter for 'community_list': The route community list. */
+   /**
+    * Getter for 'community_list': The route community list. The set is built
+    * on first use and shared by the attributes with the same list; it is
+    * valid until the list of these attributes changes.
+    * community_list_sorted() and community_list_contains() read the list
+    * without building the set.
+    */
    std::unordered_set<uint32_t> const & community_list() const;
    /** Setter for 'community_list'. */
    void community_list_is(std::unordered_set<uint32_t> const & community_list);
    /** Moving Setter for 'community_list'. */
    void community_list_is(std::unordered_set<uint32_t> && community_list);
-   /** Inserts one community_list of 'value' to the set. */
+   /**
+    * Inserts one community_list of 'value' to the set. This copies and
+    * interns the whole list, so building a list of k communities this way
+    * costs O(k^2): use community_list_sorted_is() or community_list_is()
+    * to set many communities at once.
+    */
    void community_list_set(uint32_t const & value);
    /** Inserts one community_list of 'value' to the set. */
    void community_list_set(uint32_t && value);
    /** Deletes one community_list of 'value' from the set. */
    void community_list_del(uint32_t const & value);
+   /** The route community list, in ascending order. */
+   std::vector<uint32_t> const & community_list_sorted() const;
+   /** Sets the route community list from communities in any order. */
+   void community_list_sorted_is(std::vector<uint32_t> const & community_list);
+   /** Returns true if the route community list holds the given community. */
+   bool community_list_contains(uint32_t value) const;
 
    bool operator==(bgp_path_attr_t const & other) const;
    bool operator!=(bgp_path_attr_t const & other) const;
@@ -362,6 +499,70 @@ class EOS_SDK_PUBLIC bgp_path_t {
 
 EOS_SDK_PUBLIC
 std::ostream& operator<<(std::ostream& os, const bgp_path_t& obj);
+
+class bgp_path_change_impl_t;
+/**
+ * A change made to a BGP path in Adj-RIB-In.
+ *
+ * Changes are numbered in the order they are made, per address family.
+ * The path holds the attributes of the path after the change, and no
+ * attributes if the path was deleted.
+ */
+class EOS_SDK_PUBLIC bgp_path_change_t {
+ public:
+   bgp_path_change_t();
+   bgp_path_change_t(uint64_t seq, bgp_path_change_type_t type,
+                     bgp_path_t const & path);
+   bgp_path_change_t(const bgp_path_change_t& other);
+   bgp_path_change_t& operator=(
+      bgp_path_change_t const & other);
+
+   bgp_path_change_t(bgp_path_change_t && other) noexcept;
+   bgp_path_change_t & operator=(bgp_path_change_t && other) noexcept;
+   static void * operator new( std::size_t, void * ptr ) {
+      return ptr;
+   }
+   static void * operator new( std::size_t );
+   static void operator delete( void * ) noexcept;
+
+   /** Getter for 'seq': The sequence number of the change. */
+   uint64_t seq() const;
+   /** Setter for 'seq'. */
+   void seq_is(uint64_t seq);
+
+   /** Getter for 'type': The kind of change. */
+   bgp_path_change_type_t type() const;
+   /** Setter for 'type'. */
+   void type_is(bgp_path_change_type_t type);
+
+   /** Getter for 'path': The path, as it is after the change. */
+   bgp_path_t path() const;
+   /** Setter for 'path'. */
+   void path_is(bgp_path_t const & path);
+   /** Moving Setter for 'path'. */
+   void path_is(bgp_path_t && path);
+
+   bool operator==(bgp_path_change_t const & other) const;
+   bool operator!=(bgp_path_change_t const & other) const;
+   /** The hash function for type bgp_path_change_t. */
+   uint32_t hash() const;
+   /** The hash mix function for type bgp_path_change_t. */
+   void mix_me(hash_mix & h) const;
+   /** Returns a string representation of the current object's values. */
+   std::string to_string() const;
+   /**
+    * A utility stream operator that adds a string representation of
+    * bgp_path_change_t to the ostream.
+    */
+   friend std::ostream& operator<<(std::ostream& os,
+                                   const bgp_path_change_t& obj);
+
+ private:
+   std::shared_ptr<bgp_path_change_impl_t> pimpl;
+};
+
+EOS_SDK_PUBLIC
+std::ostream& operator<<(std::ostream& os, const bgp_path_change_t& obj);
 }
 
 #endif // EOS_TYPES_BGP_PATH_H
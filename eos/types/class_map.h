@@ -46,6 +46,10 @@ class class_map_rule_impl_t;
  * Values of this type are returned from the class map's rules() function. To
  * program class map rules first add them to a class map and then add that to EOS
  * SDK using class_map_mgr's class_map_is().
+ *
+ * Class map rules are immutable, so copies share a single instance. The rules
+ * stored by class_map_mgr are interned: equal rules share an instance too, and
+ * comparing them is cheap.
  */
 class EOS_SDK_PUBLIC class_map_rule_t {
  public:
@@ -83,7 +87,8 @@ class EOS_SDK_PUBLIC class_map_rule_t {
    friend std::ostream& operator<<(std::ostream& os, const class_map_rule_t& obj);
 
  private:
-   std::shared_ptr<class_map_rule_impl_t> pimpl;
+   friend class class_map_rule_helper;
+   std::shared_ptr<class_map_rule_impl_t const> pimpl;
 };
 
 EOS_SDK_PUBLIC
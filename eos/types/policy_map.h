@@ -659,6 +659,7 @@ class EOS_SDK_PUBLIC policy_map_rule_t {
    friend std::ostream& operator<<(std::ostream& os, const policy_map_rule_t& obj);
 
  private:
+   friend class policy_map_rule_helper;
    std::shared_ptr<policy_map_rule_impl_t> pimpl;
 };
 
@@ -403,9 +403,20 @@ class EOS_SDK_PUBLIC policy_map_rule_impl_t {
                                    const policy_map_rule_impl_t& obj);
 
  private:
+   friend class policy_map_rule_helper;
+   /** The raw rule of rules that have none set, shared by all of them. */
+   static std::shared_ptr<acl_rule_ip_t const> const & raw_rule_default();
+   /**
+    * Compares all the fields of two ACL rules: acl_rule_ip_t::operator== does
+    * not compare the ones inherited from acl_rule_base_t.
+    */
+   static bool raw_rule_equal(acl_rule_ip_t const & a, acl_rule_ip_t const & b);
+
    class_map_key_t class_map_key_;
    policy_map_rule_type_t policy_map_rule_type_;
-   acl_rule_ip_t raw_rule_;
+   // Raw rules are immutable and shared by copies. The policy map manager
+   // interns the ones it stores, so that equal rules are compared by pointer.
+   std::shared_ptr<acl_rule_ip_t const> raw_rule_;
    std::set<policy_map_action_t> actions_;
 };
 
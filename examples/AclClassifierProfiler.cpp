@@ -0,0 +1,139 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <eos/acl_classifier.h>
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Compile an IPv4 ACL of 10k rules with an acl_classifier_t, then time a
+// single-rule update and the classification of packets, one at a time and
+// in batches. This needs no agent: the classifier works on its own.
+//
+// Make the program with:
+//    bash# g++ -leos -std=gnu++14 examples/AclClassifierProfiler.cpp -o AclProfiler
+// and run it, optionally with the number of rules and packets:
+//    bash# ./AclProfiler 10000 1000000
+
+#define DEFAULT_NUM_RULES 10000
+#define DEFAULT_NUM_PACKETS 1000000
+#define BATCH_SIZE 256
+
+typedef std::chrono::steady_clock profile_clock;
+
+static double elapsed_ms(profile_clock::time_point start) {
+   return std::chrono::duration<double, std::milli>(
+      profile_clock::now() - start).count();
+}
+
+static eos::ip_addr_t ipv4(uint32_t addr) {
+   return eos::ip_addr_t(htonl(addr));
+}
+
+// Rules match on a mix of prefix lengths, protocols and port operators,
+// the way a large ACL built from many sources does.
+static eos::acl_rule_ip_t make_rule(std::mt19937 & rng) {
+   static uint8_t const prefix_lengths[] = { 8, 16, 24, 24, 28, 32, 32 };
+   static uint8_t const protocols[] = { 6, 6, 17, 0 };
+   eos::acl_rule_ip_t rule;
+   uint8_t protocol = protocols[rng() % 4];
+   if(protocol) {
+      rule.ip_protocol_is(protocol);
+   }
+   uint8_t src_len = prefix_lengths[rng() % 7];
+   uint8_t dst_len = prefix_lengths[rng() % 7];
+   rule.source_addr_is(eos::ip_addr_mask_t(ipv4(0x0a000000 | (rng() & 0xffffff)),
+                                           src_len));
+   rule.destination_addr_is(
+      eos::ip_addr_mask_t(ipv4(0xac100000 | (rng() & 0xfffff)), dst_len));
+   if(protocol) {
+      switch(rng() % 3) {
+       case 0:
+         rule.destination_port_is(
+            eos::acl_port_spec_t(eos::ACL_RANGE_EQ, uint16_t(rng() % 1024)));
+         break;
+       case 1:
+         rule.destination_port_is(
+            eos::acl_port_spec_t(eos::ACL_RANGE_BETWEEN, 1024, 2048));
+         break;
+       default:
+         break;
+      }
+   }
+   rule.action_is(rng() % 4 ? eos::ACL_PERMIT : eos::ACL_DENY);
+   return rule;
+}
+
+static eos::acl_packet_t make_packet(std::mt19937 & rng) {
+   return eos::acl_packet_t(ipv4(0x0a000000 | (rng() & 0xffffff)),
+                            ipv4(0xac100000 | (rng() & 0xfffff)),
+                            rng() % 2 ? 6 : 17,
+                            uint16_t(1024 + rng() % 64000),
+                            uint16_t(rng() % 4096));
+}
+
+int main(int argc, char ** argv) {
+   uint32_t num_rules = argc > 1 ? atoi(argv[1]) : DEFAULT_NUM_RULES;
+   uint32_t num_packets = argc > 2 ? atoi(argv[2]) : DEFAULT_NUM_PACKETS;
+   std::mt19937 rng(1);
+
+   std::vector<eos::acl_rule_ip_t> rules;
+   for(uint32_t i = 0; i < num_rules; ++i) {
+      rules.push_back(make_rule(rng));
+   }
+   std::vector<eos::acl_packet_t> packets;
+   for(uint32_t i = 0; i < num_packets; ++i) {
+      packets.push_back(make_packet(rng));
+   }
+
+   std::cout << std::fixed << std::setprecision(3);
+   eos::acl_classifier_t classifier;
+   auto start = profile_clock::now();
+   for(uint32_t i = 0; i < num_rules; ++i) {
+      classifier.rule_set((i + 1) * 10, rules[i]);
+   }
+   classifier.commit();
+   std::cout << "compile " << classifier.rule_count() << " rules: "
+             << elapsed_ms(start) << " ms" << std::endl;
+
+   // Replace a rule in the middle of the ACL.
+   start = profile_clock::now();
+   classifier.rule_set((num_rules / 2) * 10, make_rule(rng));
+   classifier.commit();
+   std::cout << "update 1 rule: " << elapsed_ms(start) << " ms" << std::endl;
+
+   uint64_t permitted = 0;
+   start = profile_clock::now();
+   for(auto const & packet : packets) {
+      permitted += classifier.classify(packet) == eos::ACL_PERMIT;
+   }
+   double single_ms = elapsed_ms(start);
+   std::cout << "classify " << num_packets << " packets: " << single_ms
+             << " ms (" << single_ms * 1e6 / num_packets << " ns/packet, "
+             << permitted << " permitted)" << std::endl;
+
+   std::vector<eos::acl_packet_t> batch;
+   std::vector<eos::acl_action_t> actions;
+   permitted = 0;
+   start = profile_clock::now();
+   for(size_t i = 0; i < packets.size(); i += BATCH_SIZE) {
+      batch.assign(packets.begin() + i,
+                   packets.begin() + std::min(packets.size(), i + BATCH_SIZE));
+      classifier.classify(batch, actions);
+      for(auto action : actions) {
+         permitted += action == eos::ACL_PERMIT;
+      }
+   }
+   double batch_ms = elapsed_ms(start);
+   std::cout << "classify " << num_packets << " packets in batches of "
+             << BATCH_SIZE << ": " << batch_ms << " ms ("
+             << batch_ms * 1e6 / num_packets << " ns/packet, "
+             << permitted << " permitted)" << std::endl;
+   return 0;
+}
@@ -9,6 +9,7 @@
 #include <unordered_map>
 
 uint32_t DUMP_INTERVAL = 60;
+uint32_t PAGE_SIZE = 1000;
 
 /**
  * This example agent reacts to the post-policy path change from IPv4 and IPv6
@@ -17,6 +18,11 @@ uint32_t DUMP_INTERVAL = 60;
  * the agent log file after BGP is converged. The nexthop and community list
  * fields are enabled in the options.
  *
+ * The copy is read a page at a time once BGP has converged, then kept up to
+ * date from the batches of path changes, which carry the path attributes:
+ * no lookup is made per changed path. The sequence number noted before
+ * reading the paths tells which changes the copy already has.
+ *
  * To enable tracing, add the following configuration:
  *   switch(config)# trace <agent>-<daemon> setting BgpPathTestAgent
  *
@@ -37,6 +43,8 @@ class BgpPathTestAgent : public eos::agent_handler,
                          public eos::bgp_path_handler,
                          public eos::timeout_handler {
  public:
+   typedef std::unordered_map<eos::bgp_path_key_t, eos::bgp_path_t> path_map;
+
    eos::tracer t;
    eos::bgp_path_mgr *bgp_path_mgr_;
 
@@ -55,11 +63,14 @@ class BgpPathTestAgent : public eos::agent_handler,
       path_attr_fields.community_list_is(true);
       eos::bgp_path_options_t options(eos::BGP_PATH_POST_POLICY);
       options.path_attr_fields_is(path_attr_fields);
-
-      for (auto iter = bgp_path_mgr_->ipv4_unicast_path_iter(options); iter;
-           ++iter) {
-         ipv4_unicast_paths[iter->path_key()] = *iter;
-      }
+      options.page_size_is(PAGE_SIZE);
+
+      ipv4_unicast_seq = bgp_path_mgr_->ipv4_unicast_path_seq();
+      do {
+         for (auto const & path : bgp_path_mgr_->ipv4_unicast_paths(options)) {
+            ipv4_unicast_paths[path.path_key()] = path;
+         }
+      } while (!options.page_token().empty());
    }
 
    void take_ipv6_unicast_paths_snap_shot() {
@@ -67,11 +78,14 @@ class BgpPathTestAgent : public eos::agent_handler,
       path_attr_fields.community_list_is(true);
       eos::bgp_path_options_t options(eos::BGP_PATH_POST_POLICY);
       options.path_attr_fields_is(path_attr_fields);
-
-      for (auto iter = bgp_path_mgr_->ipv6_unicast_path_iter(options); iter;
-           ++iter) {
-         ipv6_unicast_paths[iter->path_key()] = *iter;
-      }
+      options.page_size_is(PAGE_SIZE);
+
+      ipv6_unicast_seq = bgp_path_mgr_->ipv6_unicast_path_seq();
+      do {
+         for (auto const & path : bgp_path_mgr_->ipv6_unicast_paths(options)) {
+            ipv6_unicast_paths[path.path_key()] = path;
+         }
+      } while (!options.page_token().empty());
    }
 
    void on_initialized() {
@@ -133,49 +147,30 @@ class BgpPathTestAgent : public eos::agent_handler,
       }
    }
 
-   void on_ipv4_unicast_path(eos::bgp_path_key_t const & path_key) {
-      eos::bgp_path_attr_fields_t path_attr_fields(true);
-      path_attr_fields.community_list_is(true);
-      eos::bgp_path_options_t options(eos::BGP_PATH_POST_POLICY);
-      options.path_attr_fields_is(path_attr_fields);
-
-      eos::bgp_path_t path = bgp_path_mgr_->ipv4_unicast_path(path_key, 
-                                                              options);
-      if(path == eos::bgp_path_t()) {
-         
-         // path delete
-         ipv4_unicast_paths.erase(path_key);
-      } else if(ipv4_unicast_paths.count(path_key)){
-         
-         // path update
-         ipv4_unicast_paths[path_key] = path;
-      } else {
-         
-         // new path
-         ipv4_unicast_paths[path_key] = path;
-      }
+   void on_ipv4_unicast_path_changes(
+         std::vector<eos::bgp_path_change_t> const & changes) {
+      apply_changes(changes, ipv4_unicast_seq, ipv4_unicast_paths);
    }
 
-   void on_ipv6_unicast_path(eos::bgp_path_key_t const & path_key) {
-      eos::bgp_path_attr_fields_t path_attr_fields(true);
-      path_attr_fields.community_list_is(true);
-      eos::bgp_path_options_t options(eos::BGP_PATH_POST_POLICY);
-      options.path_attr_fields_is(path_attr_fields);
+   void on_ipv6_unicast_path_changes(
+         std::vector<eos::bgp_path_change_t> const & changes) {
+      apply_changes(changes, ipv6_unicast_seq, ipv6_unicast_paths);
+   }
 
-      eos::bgp_path_t path = bgp_path_mgr_->ipv6_unicast_path(path_key, 
-                                                              options);
-      if(path == eos::bgp_path_t()) {
-         
-         // path delete
-         ipv6_unicast_paths.erase(path_key);
-      } else if(ipv6_unicast_paths.count(path_key)){
-         
-         // path update
-         ipv6_unicast_paths[path_key] = path;
-      } else {
-         
-         // new path
-         ipv6_unicast_paths[path_key] = path;
+   /// Applies the changes made after the paths were read.
+   void apply_changes(std::vector<eos::bgp_path_change_t> const & changes,
+                      uint64_t & seq, path_map & paths) {
+      for(auto const & change : changes) {
+         if(change.seq() <= seq) {
+            continue;
+         }
+         eos::bgp_path_t path = change.path();
+         if(change.type() == eos::BGP_PATH_DELETED) {
+            paths.erase(path.path_key());
+         } else {
+            paths[path.path_key()] = path;
+         }
+         seq = change.seq();
       }
    }
 
@@ -187,8 +182,11 @@ class BgpPathTestAgent : public eos::agent_handler,
    }
 
  private:
-   std::unordered_map<eos::bgp_path_key_t, eos::bgp_path_t> ipv4_unicast_paths;
-   std::unordered_map<eos::bgp_path_key_t, eos::bgp_path_t> ipv6_unicast_paths;
+   path_map ipv4_unicast_paths;
+   path_map ipv6_unicast_paths;
+   // The sequence number of the last change in each copy.
+   uint64_t ipv4_unicast_seq = 0;
+   uint64_t ipv6_unicast_seq = 0;
 };
 
 int main(int argc, char** argv) {
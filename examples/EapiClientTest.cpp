@@ -0,0 +1,258 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <eos/eapi_client.h>
+#include <eos/event_loop.h>
+#include <eos/sdk.h>
+#include <eos/timer.h>
+
+#include <map>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// This is a script (not an agent) that runs eos::eapi_client_t against a
+// local stand-in for the eAPI server instead of the Cli server of the
+// switch. The client is driven by eos::event_loop, so this needs the event
+// loop of an EOS switch: the stub libeos built from this tree does not
+// dispatch file descriptors, and every round there times out.
+//
+// The stand-in runs in a child process, listens on a unix-domain socket
+// of its own, and answers each request according to the show command it
+// carries:
+// - "show error" gets a JSON-RPC error, with the outputs of the commands
+//   that ran before the failing one;
+// - "show chunked" gets its reply with chunked transfer encoding;
+// - "show http-error" gets an HTTP 500 reply without a JSON body;
+// - "show close" makes the server close the connection without replying,
+//   which fails the requests in flight;
+// - any other command succeeds.
+// The requests of each round are all sent before any reply is read, so
+// they are pipelined on a single connection.
+//
+// Build using:
+//    g++ -std=gnu++14 -leos examples/EapiClientTest.cpp -o EapiClientTest
+// Then copy it to the switch and run "./EapiClientTest" from bash: it
+// prints every response, and exits with a non-zero status if one was not
+// the expected one or did not come in time.
+
+// How long to wait for the responses of a round, in seconds.
+#define ROUND_TIMEOUT 5
+
+// -- The stand-in eAPI server
+
+/// Reads the next request of a connection into body.
+static bool request_read(int fd, std::string & buf, std::string & body) {
+   for(;;) {
+      size_t headers_end = buf.find("\r\n\r\n");
+      if(headers_end != std::string::npos) {
+         size_t length = 0;
+         size_t header = buf.find("Content-Length: ");
+         if(header < headers_end) {
+            length = strtoul(buf.c_str() + header + 16, NULL, 10);
+         }
+         if(buf.size() >= headers_end + 4 + length) {
+            body = buf.substr(headers_end + 4, length);
+            buf.erase(0, headers_end + 4 + length);
+            return true;
+         }
+      }
+      char chunk[4096];
+      ssize_t len = read(fd, chunk, sizeof(chunk));
+      if(len <= 0) {
+         return false;
+      }
+      buf.append(chunk, len);
+   }
+}
+
+static void write_all(int fd, std::string const & data) {
+   size_t pos = 0;
+   while(pos < data.size()) {
+      ssize_t len = write(fd, data.data() + pos, data.size() - pos);
+      if(len <= 0) {
+         return;
+      }
+      pos += len;
+   }
+}
+
+/// Sends a reply, in chunks of a few bytes if chunked is set.
+static void reply(int fd, std::string const & status, std::string const & body,
+                  bool chunked) {
+   std::string out = "HTTP/1.1 " + status + "\r\n"
+                     "Content-Type: application/json\r\n";
+   if(!chunked) {
+      out += "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n";
+      out += body;
+   } else {
+      out += "Transfer-Encoding: chunked\r\n\r\n";
+      for(size_t pos = 0; pos < body.size(); pos += 7) {
+         std::string chunk = body.substr(pos, 7);
+         char size[16];
+         snprintf(size, sizeof(size), "%zx", chunk.size());
+         // Chunk extensions and trailers must be ignored by the client.
+         out += std::string(size) + ";ext=1\r\n" + chunk + "\r\n";
+      }
+      out += "0\r\nX-Trailer: 1\r\n\r\n";
+   }
+   write_all(fd, out);
+}
+
+static void connection_serve(int fd) {
+   std::string buf;
+   std::string body;
+   while(request_read(fd, buf, body)) {
+      // The id is the last member of a request, echoed in the reply.
+      size_t id_pos = body.rfind("\"id\": ");
+      std::string id = body.substr(id_pos + 6, body.rfind('}') - id_pos - 6);
+      if(body.find("show close") != std::string::npos) {
+         break;
+      } else if(body.find("show http-error") != std::string::npos) {
+         reply(fd, "500 Internal Server Error", "Internal error", false);
+      } else if(body.find("show error") != std::string::npos) {
+         reply(fd, "200 OK", "{\"jsonrpc\": \"2.0\", \"id\": " + id + ", "
+               "\"error\": {\"code\": 1002, \"message\": \"CLI command 2 of 2 "
+               "'show error' failed: invalid command\", "
+               "\"data\": [{}, {\"errors\": [\"Invalid input\"]}]}}", false);
+      } else {
+         reply(fd, "200 OK", "{\"jsonrpc\": \"2.0\", \"id\": " + id + ", "
+               "\"result\": [{}, {\"version\": \"4.0\"}]}",
+               body.find("show chunked") != std::string::npos);
+      }
+   }
+   close(fd);
+}
+
+/// Starts the stand-in server in a child process, returning its pid.
+static pid_t server_start(std::string const & path) {
+   int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+   struct sockaddr_un addr;
+   memset(&addr, 0, sizeof(addr));
+   addr.sun_family = AF_UNIX;
+   strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+   if(listener < 0 || bind(listener, (struct sockaddr *)&addr, sizeof(addr)) ||
+      listen(listener, 4)) {
+      perror("stand-in eAPI server");
+      exit(1);
+   }
+   pid_t pid = fork();
+   if(!pid) {
+      for(;;) {
+         int fd = accept(listener, NULL, NULL);
+         if(fd < 0) {
+            _exit(0);
+         }
+         connection_serve(fd);
+      }
+   }
+   close(listener);
+   return pid;
+}
+
+// -- The client
+
+class test_client : public eos::eapi_client_t {
+ public:
+   explicit test_client(std::string const & socket_path) :
+         eos::eapi_client_t(socket_path), last_id(0), requesting(false),
+         failures(0) {
+   }
+
+   /// Sends a show command, expecting it to succeed or not.
+   void expect(std::string const & cmd, bool success) {
+      requesting = true;
+      uint64_t id = run_show_cmd(cmd);
+      requesting = false;
+      expected[id] = std::make_pair(cmd, success);
+   }
+
+   void on_eapi_response(uint64_t id, eos::eapi_response_t const & response) {
+      std::string cmd = expected[id].first;
+      bool ok = response.success() == expected[id].second;
+      if(requesting) {
+         ok = false;
+         printf("FAIL: response delivered from within the request\n");
+      }
+      if(id <= last_id) {
+         ok = false;
+         printf("FAIL: response delivered out of order\n");
+      }
+      printf("%s %-16s success=%d error=%u %s %s\n", ok ? "ok  " : "FAIL",
+             cmd.c_str(), response.success(), response.error_code(),
+             response.error_message().c_str(),
+             response.responses().empty() ? "" :
+                response.responses().back().c_str());
+      failures += !ok;
+      last_id = id;
+      expected.erase(id);
+   }
+
+   std::map<uint64_t, std::pair<std::string, bool>> expected;
+   uint64_t last_id;
+   bool requesting;
+   int failures;
+};
+
+/// Runs the event loop until all the requests sent got a response.
+static void round_run(eos::event_loop * loop, test_client & client) {
+   eos::seconds_t deadline = eos::now() + ROUND_TIMEOUT;
+   while(client.pending_requests() && eos::now() < deadline) {
+      loop->run(0.1);
+   }
+   if(client.pending_requests()) {
+      printf("FAIL: %zu requests timed out\n", client.pending_requests());
+      ++client.failures;
+   }
+}
+
+int main(int argc, char ** argv) {
+   char dir[] = "/tmp/EapiClientTest-XXXXXX";
+   if(!mkdtemp(dir)) {
+      perror("mkdtemp");
+      return 1;
+   }
+   std::string path = std::string(dir) + "/command-api.sock";
+   pid_t server = server_start(path);
+
+   eos::sdk sdk;
+   eos::event_loop * loop = sdk.get_event_loop();
+   loop->wait_for_initialized();
+   test_client client(path);
+
+   printf("Pipelined requests, with error replies:\n");
+   client.expect("show version", true);
+   client.expect("show error", false);
+   client.expect("show chunked", true);
+   client.expect("show http-error", false);
+   client.expect("show version", true);
+   round_run(loop, client);
+
+   printf("The server closes the connection:\n");
+   client.expect("show version", true);
+   client.expect("show close", false);
+   client.expect("show version", false);
+   round_run(loop, client);
+
+   printf("The next request reconnects:\n");
+   client.expect("show version", true);
+   round_run(loop, client);
+
+   printf("The server is gone:\n");
+   kill(server, SIGTERM);
+   waitpid(server, NULL, 0);
+   unlink(path.c_str());
+   rmdir(dir);
+   client.expect("show version", false);
+   client.expect("show version", false);
+   round_run(loop, client);
+
+   printf("%s\n", client.failures ? "FAILED" : "PASSED");
+   return client.failures ? 1 : 0;
+}
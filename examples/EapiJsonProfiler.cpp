@@ -0,0 +1,100 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <eos/eapi_json.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Build the JSON output of "show interfaces" for enough interfaces to make
+// about 50 MB of text, then time the query of the line protocol status of
+// every interface with a json_view_t. This needs no agent: the views work
+// on any text.
+//
+// Make the program with:
+//    bash# g++ -leos -std=gnu++14 examples/EapiJsonProfiler.cpp -o JsonProfiler
+// and run it, optionally with the size of the output in MB:
+//    bash# ./JsonProfiler 50
+
+#define DEFAULT_SIZE_MB 50
+#define NUM_QUERIES 5
+
+typedef std::chrono::steady_clock profile_clock;
+
+static double elapsed_ms(profile_clock::time_point start) {
+   return std::chrono::duration<double, std::milli>(
+      profile_clock::now() - start).count();
+}
+
+// One interface, with the members "show interfaces" reports, its line
+// protocol status among the last ones, so that a query skips the others.
+static void intf_add(std::string & json, uint32_t i) {
+   std::string name = "Ethernet" + std::to_string(i / 4 + 1) + "/" +
+                      std::to_string(i % 4 + 1);
+   json += "\"" + name + "\": {"
+      "\"name\": \"" + name + "\", "
+      "\"description\": \"to rack " + std::to_string(i % 97) + "\", "
+      "\"mtu\": 9214, \"bandwidth\": 100000000000, "
+      "\"hardware\": \"ethernet\", \"duplex\": \"duplexFull\", "
+      "\"physicalAddress\": \"00:1c:73:00:00:01\", "
+      "\"burnedInAddress\": \"00:1c:73:00:00:01\", "
+      "\"interfaceAddress\": [], "
+      "\"interfaceCounters\": {\"inOctets\": " + std::to_string(i * 7919ull) +
+      ", \"outOctets\": " + std::to_string(i * 104729ull) + ", "
+      "\"inUcastPkts\": 1234567, \"outUcastPkts\": 7654321, "
+      "\"inMulticastPkts\": 42, \"outMulticastPkts\": 24, "
+      "\"inBroadcastPkts\": 3, \"outBroadcastPkts\": 5, "
+      "\"inDiscards\": 0, \"outDiscards\": 0, \"totalInErrors\": 0, "
+      "\"totalOutErrors\": 0, \"linkStatusChanges\": 2, "
+      "\"lastClear\": 1700000000.5, "
+      "\"inputErrorsDetail\": {\"runtFrames\": 0, \"giantFrames\": 0, "
+      "\"fcsErrors\": 0, \"alignmentErrors\": 0, \"symbolErrors\": 0, "
+      "\"rxPause\": 0}, "
+      "\"outputErrorsDetail\": {\"collisions\": 0, \"lateCollisions\": 0, "
+      "\"deferredTransmissions\": 0, \"txPause\": 0}}, "
+      "\"interfaceStatistics\": {\"updateInterval\": 300.0, "
+      "\"inBitsRate\": 12345.6, \"outBitsRate\": 65432.1, "
+      "\"inPktsRate\": 12.5, \"outPktsRate\": 21.5}, "
+      "\"lastStatusChangeTimestamp\": 1700000000.25, "
+      "\"forwardingModel\": \"bridged\", "
+      "\"interfaceStatus\": \"connected\", "
+      "\"lineProtocolStatus\": \"" + (i % 10 ? "up" : "down") + "\", "
+      "\"autoNegotiate\": \"success\", \"loopbackMode\": \"loopbackNone\"}";
+}
+
+int main(int argc, char ** argv) {
+   size_t size = (argc > 1 ? atoi(argv[1]) : DEFAULT_SIZE_MB) * 1000000ull;
+   std::string json = "{\"interfaces\": {";
+   uint32_t num_intfs = 0;
+   while(json.size() < size) {
+      if(num_intfs) {
+         json += ", ";
+      }
+      intf_add(json, num_intfs++);
+   }
+   json += "}}";
+
+   std::cout << std::fixed << std::setprecision(3);
+   std::cout << num_intfs << " interfaces, " << json.size() / 1e6 << " MB"
+             << std::endl;
+   eos::json_view_t root(json);
+   for(int i = 0; i < NUM_QUERIES; ++i) {
+      auto start = profile_clock::now();
+      auto matches = root.query("interfaces/*/lineProtocolStatus");
+      uint32_t up = 0;
+      for(auto const & match : matches) {
+         up += match.value().string_equals("up");
+      }
+      double ms = elapsed_ms(start);
+      std::cout << "query interfaces/*/lineProtocolStatus: " << ms << " ms ("
+                << json.size() / 1e3 / ms << " MB/s, " << matches.size()
+                << " interfaces, " << up << " up)" << std::endl;
+      if(matches.size() != num_intfs) {
+         return 1;
+      }
+   }
+   return 0;
+}
@@ -0,0 +1,121 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <eos/mac_table_cache.h>
+#include <eos/sdk.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Fill a mac_table_cache_t with 256k MAC entries spread over VLANs and
+// interfaces, then time moving them, looking them up, and listing them by
+// VLAN and by interface. The entries are fed to the cache as MAC table
+// notifications, so this needs no MAC table: it runs outside of EOS.
+//
+// Make the program with:
+//    bash# g++ -leos -std=gnu++14 examples/MacTableCacheProfiler.cpp -o MacProfiler
+// and run it, optionally with the number of entries:
+//    bash# ./MacProfiler 262144
+
+#define DEFAULT_NUM_MACS 262144
+#define NUM_VLANS 256
+#define NUM_INTFS 48
+
+typedef std::chrono::steady_clock profile_clock;
+
+static double elapsed_ms(profile_clock::time_point start) {
+   return std::chrono::duration<double, std::milli>(
+      profile_clock::now() - start).count();
+}
+
+static void report(std::string const & what, uint32_t count, double ms) {
+   std::cout << what << ": " << ms << " ms (" << ms * 1e6 / count
+             << " ns each)" << std::endl;
+}
+
+// The MACs are spread round-robin over the VLANs and the interfaces.
+static eos::mac_key_t make_key(uint32_t i) {
+   return eos::mac_key_t(1 + i % NUM_VLANS,
+                         eos::eth_addr_t(0x02, 0, 0, i >> 16, i >> 8, i));
+}
+
+int main(int argc, char ** argv) {
+   uint32_t num_macs = argc > 1 ? atoi(argv[1]) : DEFAULT_NUM_MACS;
+   eos::sdk sdk;
+   eos::mac_table_cache_t cache(sdk.get_mac_table_mgr());
+
+   std::vector<eos::intf_id_t> intfs;
+   for(uint32_t i = 1; i <= NUM_INTFS; ++i) {
+      intfs.push_back(eos::intf_id_t("Ethernet" + std::to_string(i)));
+   }
+   std::vector<eos::mac_entry_t> entries;
+   std::vector<eos::mac_entry_t> moved;
+   for(uint32_t i = 0; i < num_macs; ++i) {
+      entries.push_back(eos::mac_entry_t(make_key(i), intfs[i % NUM_INTFS]));
+      moved.push_back(eos::mac_entry_t(make_key(i),
+                                       intfs[(i + 1) % NUM_INTFS]));
+   }
+
+   std::cout << std::fixed << std::setprecision(3);
+   auto start = profile_clock::now();
+   for(auto const & entry : entries) {
+      cache.on_mac_entry_set(entry);
+   }
+   report("insert " + std::to_string(cache.size()) + " MACs", num_macs,
+          elapsed_ms(start));
+
+   // Every MAC moves to the next interface.
+   start = profile_clock::now();
+   for(auto const & entry : moved) {
+      cache.on_mac_entry_set(entry);
+   }
+   report("move " + std::to_string(num_macs) + " MACs", num_macs,
+          elapsed_ms(start));
+
+   uint32_t found = 0;
+   start = profile_clock::now();
+   for(auto const & entry : entries) {
+      found += cache.exists(entry.mac_key());
+   }
+   report("look up " + std::to_string(found) + " MACs", num_macs,
+          elapsed_ms(start));
+
+   size_t listed = 0;
+   start = profile_clock::now();
+   for(uint32_t vlan = 1; vlan <= NUM_VLANS; ++vlan) {
+      listed += cache.mac_entries_by_vlan(vlan).size();
+   }
+   report("list the MACs of " + std::to_string(NUM_VLANS) + " VLANs (" +
+          std::to_string(listed) + " MACs)", NUM_VLANS, elapsed_ms(start));
+
+   listed = 0;
+   start = profile_clock::now();
+   for(auto const & intf : intfs) {
+      listed += cache.mac_entries_by_intf(intf).size();
+   }
+   report("list the MACs of " + std::to_string(NUM_INTFS) + " interfaces (" +
+          std::to_string(listed) + " MACs)", NUM_INTFS, elapsed_ms(start));
+
+   listed = 0;
+   start = profile_clock::now();
+   for(uint32_t vlan = 1; vlan <= NUM_VLANS; ++vlan) {
+      listed += cache.mac_count_by_vlan(vlan);
+   }
+   for(auto const & intf : intfs) {
+      listed += cache.mac_count_by_intf(intf);
+   }
+   report("count the MACs of every VLAN and interface",
+          NUM_VLANS + NUM_INTFS, elapsed_ms(start));
+
+   start = profile_clock::now();
+   for(auto const & entry : entries) {
+      cache.on_mac_entry_del(entry.mac_key());
+   }
+   report("delete " + std::to_string(num_macs) + " MACs", num_macs,
+          elapsed_ms(start));
+   return cache.size() == 0 && found == num_macs ? 0 : 1;
+}
@@ -1,11 +1,21 @@
 // Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include "eos/fib.h"
+#include "eos/fib_snapshot.h"
 #include "impl.h"
 
 namespace eos {
 
+struct fib_route_key_hash {
+   size_t operator()(fib_route_key_t const & route_key) const {
+      return route_key.hash();
+   }
+};
+
 class fib_mgr_impl : public fib_mgr {
  public:
 
@@ -30,45 +40,55 @@ class fib_mgr_impl : public fib_mgr {
    }
 
    bool fib_fec_set(fib_fec_t const & fec) {
-      // TODO: add/replace the fec
+      fecs_[fec.fec_key().fec_id()] = fec;
       return true;
    }
 
    void fib_fec_del(fib_fec_key_t const & fec_key) {
-      // TODO: delete the fec from status
+      fecs_.erase(fec_key.fec_id());
       return;
    }
 
    bool fib_fec_exists(fib_fec_key_t const & fec_key) {
-      // TODO: check if fec exists
-      return true;
+      return fecs_.count(fec_key.fec_id()) != 0;
    }
 
    fib_fec_t fib_fec(fib_fec_key_t const & fec_key) {
-      // TODO: return fec from the status
-      fib_fec_t fec;
-      return fec;
+      auto it = fecs_.find(fec_key.fec_id());
+      return it != fecs_.end() ? it->second : fib_fec_t();
    }
 
    bool fib_route_set(fib_route_t const & route) {
-      // TODO: add/replace the route
+      fec_ref_del(route.route_key());
+      routes_[route.route_key()] = route;
+      fec_routes_[route.fec_id()].insert(route.route_key());
       return true;
    }
 
    void fib_route_del(fib_route_key_t const & route_key) {
-      // TODO: delete the route from status
+      fec_ref_del(route_key);
+      routes_.erase(route_key);
       return;
    }
 
    bool fib_route_exists(fib_route_key_t const & route_key) {
-      // TODO: check if route exists
-      return true;
+      return routes_.count(route_key) != 0;
    }
 
    fib_route_t fib_route(fib_route_key_t const & route_key) {
-      // TODO: return route from the status
-      fib_route_t route;
-      return route;
+      auto it = routes_.find(route_key);
+      return it != routes_.end() ? it->second : fib_route_t();
+   }
+
+   bool fib_snapshot_write(std::string const & path) const {
+      fib_snapshot_writer writer(path);
+      for(auto const & route : routes_) {
+         writer.route_add(route.second);
+      }
+      for(auto const & fec : fecs_) {
+         writer.fec_add(fec.second);
+      }
+      return writer.commit();
    }
 
    bool register_vrf(std::string const & vrf_name, bool set_vrf) {
@@ -85,11 +105,71 @@ class fib_mgr_impl : public fib_mgr {
       return *nop;
    }
 
+   std::vector<fib_route_key_t> routes_using_fec(
+         fib_fec_key_t const & fec_key) const {
+      auto it = fec_routes_.find(fec_key.fec_id());
+      if(it == fec_routes_.end()) {
+         return std::vector<fib_route_key_t>();
+      }
+      return std::vector<fib_route_key_t>(it->second.begin(), it->second.end());
+   }
+
+   uint32_t fec_ref_count(fib_fec_key_t const & fec_key) const {
+      auto it = fec_routes_.find(fec_key.fec_id());
+      if(it == fec_routes_.end()) {
+         return 0;
+      }
+      return it->second.size();
+   }
+
    mgr_mode_type_t mode_type() {
       return MODE_TYPE_READ_ONLY;
    }
+
+ private:
+   /// Drops the reference the given route holds on its current FEC, if any.
+   void fec_ref_del(fib_route_key_t const & route_key) {
+      auto route = routes_.find(route_key);
+      if(route == routes_.end()) {
+         return;
+      }
+      auto fec = fec_routes_.find(route->second.fec_id());
+      if(fec != fec_routes_.end()) {
+         fec->second.erase(route_key);
+         if(fec->second.empty()) {
+            fec_routes_.erase(fec);
+         }
+      }
+   }
+
+   // The routes and FECs programmed through this manager, and the reverse
+   // index from a FEC id to the routes resolving via it.
+   std::unordered_map<fib_route_key_t, fib_route_t, fib_route_key_hash> routes_;
+   std::unordered_map<uint64_t, fib_fec_t> fecs_;
+   std::unordered_map<uint64_t,
+                      std::unordered_set<fib_route_key_t,
+                                         fib_route_key_hash>> fec_routes_;
 };
 
+// -- pimpl wrappers to the FEC reverse index and snapshots
+
+std::vector<fib_route_key_t>
+fib_mgr::routes_using_fec(fib_fec_key_t const & fec_key) const {
+   return static_cast<fib_mgr_impl const *>(this)->routes_using_fec(fec_key);
+}
+
+uint32_t
+fib_mgr::fec_ref_count(fib_fec_key_t const & fec_key) const {
+   return static_cast<fib_mgr_impl const *>(this)->fec_ref_count(fec_key);
+}
+
+bool
+fib_mgr::fib_snapshot_write(std::string const & path) const {
+   return static_cast<fib_mgr_impl const *>(this)->fib_snapshot_write(path);
+}
+
+// -- end of wrappers
+
 DEFINE_STUB_MGR_CTOR(fib_mgr)
 
 fib_handler::fib_handler(fib_mgr *mgr) : 
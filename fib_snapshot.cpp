@@ -0,0 +1,410 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+#include "eos/fib_snapshot.h"
+
+namespace eos {
+
+namespace {
+
+char const SNAPSHOT_MAGIC[8] = { 'E', 'O', 'S', 'F', 'I', 'B', 'S', 'N' };
+
+/// All the columns of a snapshot, in the order they are laid out on disk.
+enum column_t {
+   ROUTE_ADDR,         // uint8_t[16], the prefix address, zero padded
+   ROUTE_AF,           // uint8_t, af_t of the prefix
+   ROUTE_PREFIX_LEN,   // uint8_t
+   ROUTE_PREFERENCE,   // uint8_t
+   ROUTE_TYPE,         // uint8_t, fib_route_type_t
+   ROUTE_METRIC,       // uint32_t
+   ROUTE_FEC_ID,       // uint64_t
+   FEC_ID,             // uint64_t, sorted
+   FEC_TYPE,           // uint8_t, fib_fec_type_t
+   FEC_NHG_NAME,       // string_ref
+   FEC_VIA_BEGIN,      // uint64_t, index of the first via of the FEC
+   FEC_VIA_COUNT,      // uint32_t
+   VIA_ADDR,           // uint8_t[16], the nexthop address, zero padded
+   VIA_AF,             // uint8_t, af_t of the nexthop
+   VIA_INTF,           // string_ref
+   VIA_MPLS_LABEL,     // uint32_t
+   STRINGS,            // char[], referenced by string_ref columns
+   COLUMN_MAX,
+};
+
+/// A reference to a string in the STRINGS column.
+struct string_ref {
+   uint32_t offset;
+   uint32_t length;
+};
+
+typedef uint8_t addr_bytes[16];
+
+struct snapshot_header {
+   char magic[sizeof(SNAPSHOT_MAGIC)];
+   uint32_t version;
+   uint32_t column_count;
+   uint64_t route_count;
+   uint64_t fec_count;
+   uint64_t via_count;
+   uint64_t column_offset[COLUMN_MAX];
+   uint64_t column_size[COLUMN_MAX];
+};
+
+/// Size in bytes of one element of each column (1 for the string table).
+size_t const ELEMENT_SIZE[COLUMN_MAX] = {
+   sizeof(addr_bytes), 1, 1, 1, 1, 4, 8,
+   8, 1, sizeof(string_ref), 8, 4,
+   sizeof(addr_bytes), 1, sizeof(string_ref), 4,
+   1,
+};
+
+inline uint64_t align8(uint64_t size) {
+   return (size + 7) & ~uint64_t(7);
+}
+
+}  // namespace
+
+class fib_snapshot_writer_internal {
+ public:
+   explicit fib_snapshot_writer_internal(std::string const & path)
+      : path(path), route_count(0), fec_count(0), via_count(0) {
+   }
+
+   template <typename T>
+   void append(column_t column, T const & value) {
+      char const * bytes = reinterpret_cast<char const *>(&value);
+      columns[column].insert(columns[column].end(), bytes, bytes + sizeof(T));
+   }
+
+   void append_addr(column_t addr_column, column_t af_column,
+                    ip_addr_t const & addr) {
+      addr_bytes bytes = {};
+      if(addr.af() != AF_NULL) {
+         memcpy(bytes, addr.addr(), addr.af() == AF_IPV4 ? 4 : 16);
+      }
+      append(addr_column, bytes);
+      append(af_column, static_cast<uint8_t>(addr.af()));
+   }
+
+   void append_string(column_t column, std::string const & str) {
+      // Interface and nexthop group names repeat a lot, store each only once.
+      auto it = string_offsets.find(str);
+      if(it == string_offsets.end()) {
+         it = string_offsets.emplace(str, columns[STRINGS].size()).first;
+         columns[STRINGS].insert(columns[STRINGS].end(), str.begin(), str.end());
+      }
+      string_ref ref = { it->second, static_cast<uint32_t>(str.size()) };
+      append(column, ref);
+   }
+
+   /// Reorders the FEC columns by increasing FEC id.
+   void sort_fecs() {
+      uint64_t const * ids =
+         reinterpret_cast<uint64_t const *>(columns[FEC_ID].data());
+      std::vector<uint64_t> order(fec_count);
+      for(uint64_t i = 0; i < fec_count; ++i) {
+         order[i] = i;
+      }
+      std::stable_sort(order.begin(), order.end(),
+                       [ids](uint64_t a, uint64_t b) { return ids[a] < ids[b]; });
+      for(int column = FEC_ID; column <= FEC_VIA_COUNT; ++column) {
+         size_t size = ELEMENT_SIZE[column];
+         std::vector<char> sorted(columns[column].size());
+         for(uint64_t i = 0; i < fec_count; ++i) {
+            memcpy(&sorted[i * size], &columns[column][order[i] * size], size);
+         }
+         columns[column].swap(sorted);
+      }
+   }
+
+   bool commit() {
+      sort_fecs();
+
+      snapshot_header header = {};
+      memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+      header.version = FIB_SNAPSHOT_VERSION;
+      header.column_count = COLUMN_MAX;
+      header.route_count = route_count;
+      header.fec_count = fec_count;
+      header.via_count = via_count;
+      uint64_t size = align8(sizeof(header));
+      for(int column = 0; column < COLUMN_MAX; ++column) {
+         header.column_offset[column] = size;
+         header.column_size[column] = columns[column].size();
+         size = align8(size + columns[column].size());
+      }
+
+      std::string tmp_path = path + ".tmp";
+      int fd = open(tmp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+      if(fd < 0) {
+         return false;
+      }
+      if(ftruncate(fd, size) != 0) {
+         close(fd);
+         unlink(tmp_path.c_str());
+         return false;
+      }
+      void * map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      if(map == MAP_FAILED) {
+         close(fd);
+         unlink(tmp_path.c_str());
+         return false;
+      }
+      char * base = static_cast<char *>(map);
+      memcpy(base, &header, sizeof(header));
+      for(int column = 0; column < COLUMN_MAX; ++column) {
+         if(!columns[column].empty()) {
+            memcpy(base + header.column_offset[column], columns[column].data(),
+                   columns[column].size());
+         }
+      }
+      munmap(map, size);
+      close(fd);
+      return rename(tmp_path.c_str(), path.c_str()) == 0;
+   }
+
+   std::string path;
+   uint64_t route_count;
+   uint64_t fec_count;
+   uint64_t via_count;
+   std::vector<char> columns[COLUMN_MAX];
+   std::unordered_map<std::string, uint32_t> string_offsets;
+};
+
+fib_snapshot_writer::fib_snapshot_writer(std::string const & path)
+   : writer_(new fib_snapshot_writer_internal(path)) {
+}
+
+fib_snapshot_writer::~fib_snapshot_writer() {
+   delete writer_;
+}
+
+void
+fib_snapshot_writer::route_add(fib_route_t const & route) {
+   ip_prefix_t prefix = route.route_key().prefix();
+   writer_->append_addr(ROUTE_ADDR, ROUTE_AF, prefix.network());
+   writer_->append(ROUTE_PREFIX_LEN, prefix.prefix_length());
+   writer_->append(ROUTE_PREFERENCE, route.preference());
+   writer_->append(ROUTE_TYPE, static_cast<uint8_t>(route.route_type()));
+   writer_->append(ROUTE_METRIC, route.metric());
+   writer_->append(ROUTE_FEC_ID, route.fec_id());
+   ++writer_->route_count;
+}
+
+void
+fib_snapshot_writer::fec_add(fib_fec_t const & fec) {
+   uint32_t vias = 0;
+   uint64_t via_begin = writer_->via_count;
+   for(auto const & via : fec.via()) {
+      writer_->append_addr(VIA_ADDR, VIA_AF, via.hop());
+      intf_id_t intf = via.intf();
+      writer_->append_string(VIA_INTF, !intf ? "" : intf.to_string());
+      writer_->append(VIA_MPLS_LABEL, via.mpls_label().label());
+      ++vias;
+   }
+   writer_->append(FEC_ID, fec.fec_key().fec_id());
+   writer_->append(FEC_TYPE, static_cast<uint8_t>(fec.fec_type()));
+   writer_->append_string(FEC_NHG_NAME, fec.nexthop_group_name());
+   writer_->append(FEC_VIA_BEGIN, via_begin);
+   writer_->append(FEC_VIA_COUNT, vias);
+   writer_->via_count += vias;
+   ++writer_->fec_count;
+}
+
+bool
+fib_snapshot_writer::commit() {
+   return writer_->commit();
+}
+
+class fib_snapshot_reader_internal {
+ public:
+   explicit fib_snapshot_reader_internal(std::string const & path)
+      : base(NULL), size(0), header(NULL) {
+      int fd = open(path.c_str(), O_RDONLY);
+      if(fd < 0) {
+         return;
+      }
+      struct stat st;
+      if(fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(snapshot_header)) {
+         void * map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+         if(map != MAP_FAILED) {
+            base = static_cast<char const *>(map);
+            size = st.st_size;
+         }
+      }
+      close(fd);
+      if(base && validate()) {
+         header = reinterpret_cast<snapshot_header const *>(base);
+      }
+   }
+
+   ~fib_snapshot_reader_internal() {
+      if(base) {
+         munmap(const_cast<char *>(base), size);
+      }
+   }
+
+   bool validate() const {
+      snapshot_header const * hdr = reinterpret_cast<snapshot_header const *>(base);
+      if(memcmp(hdr->magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 ||
+         hdr->version != FIB_SNAPSHOT_VERSION ||
+         hdr->column_count != COLUMN_MAX) {
+         return false;
+      }
+      uint64_t counts[COLUMN_MAX];
+      for(int column = 0; column < COLUMN_MAX; ++column) {
+         counts[column] = column < FEC_ID ? hdr->route_count :
+                          column < VIA_ADDR ? hdr->fec_count :
+                          column < STRINGS ? hdr->via_count :
+                          hdr->column_size[STRINGS];
+      }
+      for(int column = 0; column < COLUMN_MAX; ++column) {
+         uint64_t offset = hdr->column_offset[column];
+         uint64_t column_size = hdr->column_size[column];
+         if(offset % 8 || offset > size || column_size > size - offset ||
+            column_size != counts[column] * ELEMENT_SIZE[column]) {
+            return false;
+         }
+      }
+      return true;
+   }
+
+   template <typename T>
+   T const * column(column_t column) const {
+      return reinterpret_cast<T const *>(base + header->column_offset[column]);
+   }
+
+   ip_addr_t addr(column_t addr_column, column_t af_column, uint64_t index) const {
+      af_t af = static_cast<af_t>(column<uint8_t>(af_column)[index]);
+      if(af == AF_NULL) {
+         return ip_addr_t();
+      }
+      return ip_addr_t(af, column<addr_bytes>(addr_column)[index]);
+   }
+
+   std::string string(column_t column, uint64_t index) const {
+      string_ref const & ref = this->column<string_ref>(column)[index];
+      if(ref.offset > header->column_size[STRINGS] ||
+         ref.length > header->column_size[STRINGS] - ref.offset) {
+         return std::string();
+      }
+      return std::string(this->column<char>(STRINGS) + ref.offset, ref.length);
+   }
+
+   char const * base;
+   size_t size;
+   snapshot_header const * header;
+};
+
+fib_snapshot_reader::fib_snapshot_reader(std::string const & path)
+   : reader_(new fib_snapshot_reader_internal(path)) {
+}
+
+fib_snapshot_reader::~fib_snapshot_reader() {
+   delete reader_;
+}
+
+bool
+fib_snapshot_reader::valid() const {
+   return reader_->header != NULL;
+}
+
+uint32_t
+fib_snapshot_reader::version() const {
+   return reader_->header->version;
+}
+
+uint64_t
+fib_snapshot_reader::route_count() const {
+   return reader_->header->route_count;
+}
+
+uint64_t
+fib_snapshot_reader::fec_count() const {
+   return reader_->header->fec_count;
+}
+
+uint64_t
+fib_snapshot_reader::via_count() const {
+   return reader_->header->via_count;
+}
+
+fib_route_t
+fib_snapshot_reader::route(uint64_t index) const {
+   ip_prefix_t prefix(reader_->addr(ROUTE_ADDR, ROUTE_AF, index),
+                      reader_->column<uint8_t>(ROUTE_PREFIX_LEN)[index]);
+   fib_route_t route((fib_route_key_t(prefix)));
+   route.preference_is(reader_->column<uint8_t>(ROUTE_PREFERENCE)[index]);
+   route.route_type_is(static_cast<fib_route_type_t>(
+                          reader_->column<uint8_t>(ROUTE_TYPE)[index]));
+   route.metric_is(reader_->column<uint32_t>(ROUTE_METRIC)[index]);
+   route.fec_id_is(reader_->column<uint64_t>(ROUTE_FEC_ID)[index]);
+   return route;
+}
+
+fib_fec_t
+fib_snapshot_reader::fec(uint64_t index) const {
+   fib_fec_t fec(fib_fec_key_t(reader_->column<uint64_t>(FEC_ID)[index]));
+   fec.fec_type_is(static_cast<fib_fec_type_t>(
+                      reader_->column<uint8_t>(FEC_TYPE)[index]));
+   fec.nexthop_group_name_is(reader_->string(FEC_NHG_NAME, index));
+   uint64_t via_begin = reader_->column<uint64_t>(FEC_VIA_BEGIN)[index];
+   uint32_t vias = reader_->column<uint32_t>(FEC_VIA_COUNT)[index];
+   if(via_begin > via_count() || vias > via_count() - via_begin) {
+      return fec;
+   }
+   // Walk the vias backwards so pushing to the front preserves their order.
+   std::forward_list<fib_via_t> via_list;
+   for(uint64_t via = via_begin + vias; via-- > via_begin;) {
+      std::string intf = reader_->string(VIA_INTF, via);
+      fib_via_t fib_via(reader_->addr(VIA_ADDR, VIA_AF, via),
+                        intf.empty() ? intf_id_t() : intf_id_t(intf));
+      fib_via.mpls_label_is(
+         mpls_label_t(reader_->column<uint32_t>(VIA_MPLS_LABEL)[via]));
+      via_list.push_front(fib_via);
+   }
+   fec.via_is(std::move(via_list));
+   return fec;
+}
+
+uint64_t
+fib_snapshot_reader::fec_index(uint64_t fec_id) const {
+   uint64_t const * begin = fec_ids();
+   uint64_t const * end = begin + fec_count();
+   uint64_t const * it = std::lower_bound(begin, end, fec_id);
+   if(it == end || *it != fec_id) {
+      return fec_count();
+   }
+   return it - begin;
+}
+
+uint64_t const *
+fib_snapshot_reader::route_fec_ids() const {
+   return reader_->column<uint64_t>(ROUTE_FEC_ID);
+}
+
+uint32_t const *
+fib_snapshot_reader::route_metrics() const {
+   return reader_->column<uint32_t>(ROUTE_METRIC);
+}
+
+uint64_t const *
+fib_snapshot_reader::fec_ids() const {
+   return reader_->column<uint64_t>(FEC_ID);
+}
+
+uint32_t const *
+fib_snapshot_reader::fec_via_counts() const {
+   return reader_->column<uint32_t>(FEC_VIA_COUNT);
+}
+
+} // namespace eos
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_STUBS_INTERN_H
+#define EOS_STUBS_INTERN_H
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace eos {
+
+/**
+ * A table of hash-consed immutable values.
+ *
+ * intern() returns a shared instance equal to the value given, so that
+ * equal values are stored once and can be compared by pointer. T must
+ * provide hash() (based on hash_mix); values are compared with Equal,
+ * operator== by default. The table only holds weak references: an
+ * instance is freed with its last user, and its entry is reclaimed lazily.
+ */
+template <typename T, typename Equal = std::equal_to<T>>
+class intern_table {
+ public:
+   intern_table() : sweep_size_(1024) {
+   }
+
+   std::shared_ptr<T const> intern(T const & value) {
+      uint32_t hash = value.hash();
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto range = table_.equal_range(hash);
+      for(auto it = range.first; it != range.second;) {
+         std::shared_ptr<T const> existing = it->second.lock();
+         if(!existing) {
+            it = table_.erase(it);
+         } else if(Equal()(*existing, value)) {
+            return existing;
+         } else {
+            ++it;
+         }
+      }
+      // Not allocated with make_shared, so that an unused value is freed
+      // right away rather than along with its weak entry.
+      std::shared_ptr<T const> interned(new T(value));
+      table_.emplace(hash, interned);
+      if(table_.size() >= sweep_size_) {
+         sweep();
+      }
+      return interned;
+   }
+
+ private:
+   /// Drops the entries of all values no longer in use.
+   void sweep() {
+      for(auto it = table_.begin(); it != table_.end();) {
+         if(it->second.expired()) {
+            it = table_.erase(it);
+         } else {
+            ++it;
+         }
+      }
+      sweep_size_ = std::max<size_t>(1024, 2 * table_.size());
+   }
+
+   std::mutex mutex_;
+   std::unordered_multimap<uint32_t, std::weak_ptr<T const>> table_;
+   size_t sweep_size_;
+};
+
+}
+
+#endif // EOS_STUBS_INTERN_H
@@ -3,6 +3,7 @@
 
 #include "eos/lldp.h"
 #include "impl.h"
+#include "lldp_neighbor_codec.h"
 
 namespace eos {
 
@@ -32,7 +33,17 @@ class lldp_mgr_impl : public lldp_mgr {
       return *nop;
    }
 
-   void enabled_is(bool enabled) { return; }
+   void enabled_is(bool enabled) {
+      if(enabled) {
+         return;
+      }
+      // The neighbors age out when LLDP stops running.
+      std::vector<lldp_neighbor_t> peers;
+      for(auto const & neighbor : neighbors_) {
+         peers.push_back(neighbor.first);
+      }
+      neighbors_update(std::vector<lldp_neighbor_t>(), peers);
+   }
    bool enabled() const { return true; }
    void tx_timer_is(uint32_t seconds) { return; }
    int tx_timer() const { return 99; }
@@ -89,12 +100,161 @@ class lldp_mgr_impl : public lldp_mgr {
       std::map<lldp_tlv_type_t, std::string> map;
       return map;
    }
+
+   /**
+    * Updates the neighbors learnt on the interfaces: reads the information
+    * of the neighbors set, forgets the neighbors that aged out, and notifies
+    * the handlers of what changed.
+    */
+   void neighbors_update(std::vector<lldp_neighbor_t> const & neighbors_set,
+                         std::vector<lldp_neighbor_t> const & neighbors_del) {
+      for(auto const & peer : neighbors_set) {
+         neighbor_notify(peer);
+      }
+      for(auto const & peer : neighbors_del) {
+         neighbor_del_notify(peer);
+      }
+   }
+
+   /// Registers a handler for coalesced notifications of neighbor updates.
+   void neighbor_delta_watch(lldp_handler * handler, bool should_watch) {
+      if(should_watch) {
+         delta_handlers_.insert(handler);
+      } else {
+         delta_handlers_.erase(handler);
+      }
+   }
+   bool neighbor_delta_watched(lldp_handler * handler) const {
+      return delta_handlers_.count(handler);
+   }
+
+   // A handler going away is no longer notified of deltas either.
+   void remove_handler(lldp_handler * handler) {
+      delta_handlers_.erase(handler);
+      lldp_mgr::remove_handler(handler);
+   }
+
+ private:
+   /**
+    * Notifies handlers of an update of a neighbor. Handlers watching deltas
+    * get a single on_lldp_neighbor_delta(), others get a callback per
+    * changed field then on_lldp_intf_change().
+    */
+   void neighbor_notify(lldp_neighbor_t const & peer) {
+      lldp_neighbor_info_t info = codec_.read(this, peer);
+      auto it = neighbors_.find(peer);
+      bool added = it == neighbors_.end();
+      lldp_neighbor_info_t previous;
+      if(!added) {
+         previous = it->second;
+      }
+      uint32_t changed = info.changed_fields(previous);
+      if(!added && !changed) {
+         return;
+      }
+      neighbors_[peer] = info;
+      handler_foreach([&](lldp_handler * handler) {
+         if(added) {
+            handler->on_lldp_intf_set(peer);
+         }
+         if(delta_handlers_.count(handler)) {
+            handler->on_lldp_neighbor_delta(peer, changed, info);
+         } else {
+            fields_notify(handler, peer, changed, info, previous);
+            handler->on_lldp_intf_change(peer);
+         }
+      });
+   }
+
+   /// Notifies handlers that a neighbor aged out.
+   void neighbor_del_notify(lldp_neighbor_t const & peer) {
+      if(!neighbors_.erase(peer)) {
+         return;
+      }
+      handler_foreach([&](lldp_handler * handler) {
+         handler->on_lldp_intf_del(peer);
+      });
+   }
+
+   void fields_notify(lldp_handler * handler, lldp_neighbor_t const & peer,
+                      uint32_t changed, lldp_neighbor_info_t const & info,
+                      lldp_neighbor_info_t const & previous) {
+      if(changed & LLDP_NEIGHBOR_CHASSIS_ID) {
+         handler->on_lldp_chassis_id(peer, info.chassis_id());
+      }
+      if(changed & LLDP_NEIGHBOR_INTF_ID) {
+         handler->on_lldp_intf_id(peer, info.intf_id());
+      }
+      if(changed & LLDP_NEIGHBOR_SYSTEM_NAME) {
+         handler->on_lldp_system_name(peer, info.system_name());
+      }
+      if(changed & LLDP_NEIGHBOR_SYSTEM_DESCRIPTION) {
+         handler->on_lldp_system_description(peer, info.system_description());
+      }
+      if(changed & LLDP_NEIGHBOR_INTF_DESCRIPTION) {
+         handler->on_lldp_intf_description(peer, info.intf_description());
+      }
+      if(changed & LLDP_NEIGHBOR_DEFAULT_VLAN) {
+         handler->on_lldp_default_vlan(peer, info.default_vlan());
+      }
+      if(changed & LLDP_NEIGHBOR_MANAGEMENT_VLAN) {
+         handler->on_lldp_management_vlan(peer, info.management_vlan());
+      }
+      if(changed & LLDP_NEIGHBOR_MAX_FRAME_SIZE) {
+         handler->on_lldp_max_frame_size(peer, info.max_frame_size());
+      }
+      if(changed & LLDP_NEIGHBOR_MANAGEMENT_ADDRESS) {
+         handler->on_lldp_management_address(peer, info.management_address());
+      }
+      if(changed & LLDP_NEIGHBOR_LACP) {
+         handler->on_lldp_lacp(peer, info.lacp());
+      }
+      if(changed & LLDP_NEIGHBOR_PHY) {
+         handler->on_lldp_phy(peer, info.phy());
+      }
+      if(changed & LLDP_NEIGHBOR_TLVS) {
+         auto tlvs = info.tlvs();
+         auto previous_tlvs = previous.tlvs();
+         for(auto const & tlv : tlvs) {
+            auto it = previous_tlvs.find(tlv.first);
+            if(it == previous_tlvs.end() || it->second != tlv.second) {
+               handler->on_lldp_tlv_set(peer, tlv.first, tlv.second);
+            }
+         }
+         for(auto const & tlv : previous_tlvs) {
+            if(!tlvs.count(tlv.first)) {
+               handler->on_lldp_tlv_del(peer, tlv.first);
+            }
+         }
+      }
+   }
+
+   lldp_neighbor_codec codec_;
+   // The information last notified for each neighbor.
+   std::map<lldp_neighbor_t, lldp_neighbor_info_t> neighbors_;
+   // The handlers registered with watch_lldp_neighbor_delta().
+   std::set<lldp_handler *> delta_handlers_;
 };
 
 DEFINE_STUB_MGR_CTOR(lldp_mgr)
 
 lldp_handler::lldp_handler(lldp_mgr * mgr) :
-      base_handler<lldp_mgr, lldp_handler>(mgr) {}
+      base_handler<lldp_mgr, lldp_handler>(mgr) {
+   mgr_->add_handler(this);
+}
+
+void lldp_handler::watch_lldp_neighbor_delta(bool should_watch) {
+   if(mgr_) {
+      static_cast<lldp_mgr_impl *>(mgr_)->neighbor_delta_watch(this,
+                                                                should_watch);
+   }
+}
+
+bool lldp_handler::lldp_neighbor_delta_watched() const {
+   return mgr_ &&
+      static_cast<lldp_mgr_impl *>(mgr_)->neighbor_delta_watched(
+         const_cast<lldp_handler *>(this));
+}
 
 void lldp_handler::on_lldp_tx_timer(uint32_t seconds) {}
 void lldp_handler::on_lldp_hold_time(uint32_t seconds) {}
@@ -103,6 +263,9 @@ void lldp_handler::on_lldp_intf_enabled(intf_id_t intf, lldp_intf_enabled_t) {}
 void lldp_handler::on_lldp_intf_set(lldp_neighbor_t const & peer) {}
 void lldp_handler::on_lldp_intf_del(lldp_neighbor_t const & peer) {}
 void lldp_handler::on_lldp_intf_change(lldp_neighbor_t const & peer) {}
+void lldp_handler::on_lldp_neighbor_delta(lldp_neighbor_t const & peer,
+                                          uint32_t changed_fields,
+                                          lldp_neighbor_info_t const & neighbor) {}
 
 void lldp_handler::on_lldp_tlv_set(lldp_neighbor_t const & peer, lldp_tlv_type_t,
                                    std::string const &) {}
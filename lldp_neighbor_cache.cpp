@@ -0,0 +1,165 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "eos/lldp_neighbor_cache.h"
+#include "lldp_neighbor_codec.h"
+
+namespace eos {
+
+class lldp_neighbor_cache_internal {
+ public:
+   lldp_neighbor_cache_internal() : count(0) {
+   }
+
+   /// Returns the neighbors of an interface, or NULL if it has none.
+   std::vector<lldp_neighbor_info_t> const * intf_neighbors(intf_id_t intf) const {
+      auto it = neighbors.find(intf);
+      return it != neighbors.end() ? &it->second : NULL;
+   }
+
+   /// Returns the position of a neighbor among those of its interface.
+   static std::vector<lldp_neighbor_info_t>::const_iterator
+   neighbor_find(std::vector<lldp_neighbor_info_t> const & infos,
+                 lldp_neighbor_t const & peer) {
+      return std::find_if(infos.begin(), infos.end(),
+                          [&](lldp_neighbor_info_t const & info) {
+                             return info.neighbor_ == peer;
+                          });
+   }
+
+   void neighbor_set(lldp_neighbor_info_t const & info) {
+      lldp_neighbor_t const & peer = info.neighbor_;
+      auto & infos = neighbors[peer.intf()];
+      auto it = neighbor_find(infos, peer);
+      if(it != infos.end()) {
+         infos[it - infos.begin()] = info;
+      } else {
+         infos.push_back(info);
+         ++count;
+      }
+   }
+
+   void neighbor_del(lldp_neighbor_t const & peer) {
+      auto intf = neighbors.find(peer.intf());
+      if(intf == neighbors.end()) {
+         return;
+      }
+      auto it = neighbor_find(intf->second, peer);
+      if(it == intf->second.end()) {
+         return;
+      }
+      intf->second.erase(it);
+      --count;
+      if(intf->second.empty()) {
+         neighbors.erase(intf);
+      }
+   }
+
+   size_t system_count() const {
+      std::unordered_set<std::string const *> systems;
+      for(auto const & intf : neighbors) {
+         for(auto const & info : intf.second) {
+            systems.insert(info.system_.get());
+         }
+      }
+      return systems.size();
+   }
+
+   lldp_neighbor_codec codec;
+   std::map<intf_id_t, std::vector<lldp_neighbor_info_t>> neighbors;
+   size_t count;
+};
+
+lldp_neighbor_cache_t::lldp_neighbor_cache_t(lldp_mgr * mgr) :
+      lldp_handler(mgr), cache_(new lldp_neighbor_cache_internal()) {
+   watch_lldp_neighbor_delta(true);
+}
+
+lldp_neighbor_cache_t::~lldp_neighbor_cache_t() {
+   delete cache_;
+}
+
+void
+lldp_neighbor_cache_t::resync() {
+   lldp_mgr * mgr = get_lldp_mgr();
+   cache_->neighbors.clear();
+   cache_->count = 0;
+   for(auto iter = mgr->lldp_neighbor_iter(); iter; ++iter) {
+      neighbor_update(*iter);
+   }
+}
+
+void
+lldp_neighbor_cache_t::neighbor_update(lldp_neighbor_t const & neighbor) {
+   cache_->neighbor_set(cache_->codec.read(get_lldp_mgr(), neighbor));
+}
+
+void
+lldp_neighbor_cache_t::clear() {
+   cache_->neighbors.clear();
+   cache_->count = 0;
+}
+
+size_t
+lldp_neighbor_cache_t::size() const {
+   return cache_->count;
+}
+
+bool
+lldp_neighbor_cache_t::exists(lldp_neighbor_t const & neighbor) const {
+   auto infos = cache_->intf_neighbors(neighbor.intf());
+   return infos && cache_->neighbor_find(*infos, neighbor) != infos->end();
+}
+
+lldp_neighbor_info_t
+lldp_neighbor_cache_t::neighbor(lldp_neighbor_t const & neighbor) const {
+   auto infos = cache_->intf_neighbors(neighbor.intf());
+   if(!infos) {
+      return lldp_neighbor_info_t();
+   }
+   auto it = cache_->neighbor_find(*infos, neighbor);
+   return it != infos->end() ? *it : lldp_neighbor_info_t();
+}
+
+std::vector<lldp_neighbor_info_t>
+lldp_neighbor_cache_t::neighbors(intf_id_t intf) const {
+   auto infos = cache_->intf_neighbors(intf);
+   return infos ? *infos : std::vector<lldp_neighbor_info_t>();
+}
+
+std::vector<lldp_neighbor_info_t>
+lldp_neighbor_cache_t::snapshot() const {
+   std::vector<lldp_neighbor_info_t> result;
+   result.reserve(cache_->count);
+   for(auto const & intf : cache_->neighbors) {
+      result.insert(result.end(), intf.second.begin(), intf.second.end());
+   }
+   return result;
+}
+
+size_t
+lldp_neighbor_cache_t::system_count() const {
+   return cache_->system_count();
+}
+
+void
+lldp_neighbor_cache_t::on_lldp_intf_change(lldp_neighbor_t const & peer) {
+   neighbor_update(peer);
+}
+
+void
+lldp_neighbor_cache_t::on_lldp_neighbor_delta(lldp_neighbor_t const & peer,
+                                              uint32_t changed_fields,
+                                              lldp_neighbor_info_t const & neighbor) {
+   cache_->neighbor_set(neighbor);
+}
+
+void
+lldp_neighbor_cache_t::on_lldp_intf_del(lldp_neighbor_t const & peer) {
+   cache_->neighbor_del(peer);
+}
+
+}  // namespace eos
@@ -0,0 +1,455 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "eos/hash_mix.h"
+#include "lldp_neighbor_codec.h"
+
+namespace eos {
+
+namespace {
+
+/**
+ * The information of a neighbor is encoded as a sequence of fields, each
+ * made of a tag byte, the length of its value as a base 128 varint, and
+ * its value. Integers are encoded in network byte order.
+ */
+enum field_tag_t {
+   // Fields of the remote system.
+   FIELD_CHASSIS_ID = 1,  // The encoding byte, then the ID.
+   FIELD_SYSTEM_NAME,
+   FIELD_SYSTEM_DESCRIPTION,
+   FIELD_SYSTEM_CAPABILITIES,  // One byte of lldp_syscap_bits_t.
+   FIELD_MANAGEMENT_VLAN,  // 16 bits.
+   // The family and the ifindex on 32 bits, the length of the address as a
+   // varint, the address, then the OID.
+   FIELD_MANAGEMENT_ADDRESS,
+   // Fields of the remote port.
+   FIELD_INTF_ID,  // The encoding byte, then the ID.
+   FIELD_INTF_DESCRIPTION,
+   FIELD_DEFAULT_VLAN,  // 16 bits.
+   FIELD_MAX_FRAME_SIZE,  // 32 bits.
+   FIELD_LACP,  // One byte of flags, then the ID on 32 bits.
+   FIELD_PHY,  // One byte of flags, then the capabilities on 16 bits.
+   FIELD_TLV,  // The organization on 32 bits, the subtype byte, the payload.
+   FIELD_TAG_COUNT,
+};
+
+/// The lldp_neighbor_field_t of each field tag.
+uint32_t const field_bits[FIELD_TAG_COUNT] = {
+   0,
+   LLDP_NEIGHBOR_CHASSIS_ID,
+   LLDP_NEIGHBOR_SYSTEM_NAME,
+   LLDP_NEIGHBOR_SYSTEM_DESCRIPTION,
+   LLDP_NEIGHBOR_SYSTEM_CAPABILITIES,
+   LLDP_NEIGHBOR_MANAGEMENT_VLAN,
+   LLDP_NEIGHBOR_MANAGEMENT_ADDRESS,
+   LLDP_NEIGHBOR_INTF_ID,
+   LLDP_NEIGHBOR_INTF_DESCRIPTION,
+   LLDP_NEIGHBOR_DEFAULT_VLAN,
+   LLDP_NEIGHBOR_MAX_FRAME_SIZE,
+   LLDP_NEIGHBOR_LACP,
+   LLDP_NEIGHBOR_PHY,
+   LLDP_NEIGHBOR_TLVS,
+};
+
+void put_varint(std::string & out, size_t value) {
+   while(value >= 0x80) {
+      out.push_back(char(value | 0x80));
+      value >>= 7;
+   }
+   out.push_back(char(value));
+}
+
+void put_uint(std::string & out, uint32_t value, int bytes) {
+   for(int i = bytes - 1; i >= 0; --i) {
+      out.push_back(char(value >> (8 * i)));
+   }
+}
+
+void put_field(std::string & out, field_tag_t tag, std::string const & value) {
+   out.push_back(char(tag));
+   put_varint(out, value.size());
+   out.append(value);
+}
+
+void put_uint_field(std::string & out, field_tag_t tag, uint32_t value,
+                    int bytes) {
+   out.push_back(char(tag));
+   put_varint(out, bytes);
+   put_uint(out, value, bytes);
+}
+
+/// A cursor over an encoded value.
+struct reader {
+   char const * pos;
+   char const * end;
+
+   bool done() const {
+      return pos >= end;
+   }
+
+   size_t varint() {
+      size_t value = 0;
+      for(int shift = 0; pos < end; shift += 7) {
+         uint8_t byte = *pos++;
+         value |= size_t(byte & 0x7f) << shift;
+         if(!(byte & 0x80)) {
+            break;
+         }
+      }
+      return value;
+   }
+
+   uint32_t uint(int bytes) {
+      uint32_t value = 0;
+      for(int i = 0; i < bytes && pos < end; ++i) {
+         value = (value << 8) | uint8_t(*pos++);
+      }
+      return value;
+   }
+
+   std::string bytes(size_t len) {
+      len = std::min<size_t>(len, end - pos);
+      std::string value(pos, len);
+      pos += len;
+      return value;
+   }
+
+   /// Reads the next field, returning its tag and a reader over its value.
+   field_tag_t field(reader & value) {
+      field_tag_t tag = field_tag_t(uint8_t(*pos++));
+      size_t len = std::min<size_t>(varint(), end - pos);
+      value = reader{pos, pos + len};
+      pos += len;
+      return tag;
+   }
+};
+
+reader blob_reader(std::shared_ptr<std::string const> const & blob) {
+   if(!blob) {
+      return reader{NULL, NULL};
+   }
+   return reader{blob->data(), blob->data() + blob->size()};
+}
+
+/// Calls f(value) for each field of a blob with the given tag.
+template <typename Func>
+void fields_foreach(std::shared_ptr<std::string const> const & blob,
+                    field_tag_t tag, Func f) {
+   reader r = blob_reader(blob);
+   while(!r.done()) {
+      reader value;
+      if(r.field(value) == tag) {
+         f(value);
+      }
+   }
+}
+
+/// Finds the first field of a blob with the given tag.
+bool field_find(std::shared_ptr<std::string const> const & blob,
+                field_tag_t tag, reader & value) {
+   reader r = blob_reader(blob);
+   while(!r.done()) {
+      if(r.field(value) == tag) {
+         return true;
+      }
+   }
+   return false;
+}
+
+std::string string_field(std::shared_ptr<std::string const> const & blob,
+                         field_tag_t tag) {
+   reader value;
+   if(!field_find(blob, tag, value)) {
+      return std::string();
+   }
+   return value.bytes(value.end - value.pos);
+}
+
+uint32_t uint_field(std::shared_ptr<std::string const> const & blob,
+                    field_tag_t tag, int bytes) {
+   reader value;
+   return field_find(blob, tag, value) ? value.uint(bytes) : 0;
+}
+
+/**
+ * Returns the bits of the fields that differ between two blobs. Fields
+ * are encoded in tag order, so the fields with a given tag, if repeated,
+ * are contiguous and compared as a whole.
+ */
+uint32_t blob_diff(std::shared_ptr<std::string const> const & blob,
+                   std::shared_ptr<std::string const> const & other) {
+   if(blob == other) {
+      return 0;
+   }
+   struct span {
+      char const * first;
+      char const * last;
+   };
+   span spans[2][FIELD_TAG_COUNT] = {};
+   std::shared_ptr<std::string const> const * blobs[2] = {&blob, &other};
+   for(int i = 0; i < 2; ++i) {
+      reader r = blob_reader(*blobs[i]);
+      while(!r.done()) {
+         char const * first = r.pos;
+         reader value;
+         uint8_t tag = r.field(value);
+         if(tag < FIELD_TAG_COUNT) {
+            span & s = spans[i][tag];
+            s.first = s.first ? s.first : first;
+            s.last = r.pos;
+         }
+      }
+   }
+   uint32_t changed = 0;
+   for(int tag = 1; tag < FIELD_TAG_COUNT; ++tag) {
+      span const & a = spans[0][tag];
+      span const & b = spans[1][tag];
+      if(a.last - a.first != b.last - b.first ||
+         (a.first && memcmp(a.first, b.first, a.last - a.first))) {
+         changed |= field_bits[tag];
+      }
+   }
+   return changed;
+}
+
+/// Encodes the fields of the remote system of a neighbor.
+std::string system_encode(lldp_mgr const * mgr, lldp_neighbor_t const & peer) {
+   std::string out;
+   lldp_chassis_id_t chassis = mgr->chassis_id(peer);
+   std::string value(1, char(chassis.encoding()));
+   put_field(out, FIELD_CHASSIS_ID, value.append(chassis.value()));
+   put_field(out, FIELD_SYSTEM_NAME, mgr->system_name(peer));
+   put_field(out, FIELD_SYSTEM_DESCRIPTION, mgr->system_description(peer));
+   lldp_syscap_t syscap = mgr->system_capabilities(peer);
+   uint32_t bits = (syscap.repeater() ? LLDP_SYSCAP_REPEATER : 0) |
+                   (syscap.bridge() ? LLDP_SYSCAP_BRIDGE : 0) |
+                   (syscap.vlan_ap() ? LLDP_SYSCAP_VLAN_AP : 0) |
+                   (syscap.router() ? LLDP_SYSCAP_ROUTER : 0) |
+                   (syscap.telephone() ? LLDP_SYSCAP_TELEPONE : 0) |
+                   (syscap.docsis() ? LLDP_SYSCAP_DOCSIS : 0) |
+                   (syscap.station() ? LLDP_SYSCAP_STATION : 0);
+   put_uint_field(out, FIELD_SYSTEM_CAPABILITIES, bits, 1);
+   put_uint_field(out, FIELD_MANAGEMENT_VLAN, mgr->management_vlan(peer), 2);
+   for(auto const & address : mgr->management_address(peer)) {
+      std::string value;
+      put_uint(value, address.address_family(), 4);
+      put_uint(value, address.snmp_ifindex(), 4);
+      std::string addr = address.address();
+      put_varint(value, addr.size());
+      value.append(addr).append(address.oid());
+      put_field(out, FIELD_MANAGEMENT_ADDRESS, value);
+   }
+   return out;
+}
+
+/// Encodes the fields of the remote port of a neighbor.
+std::string port_encode(lldp_mgr const * mgr, lldp_neighbor_t const & peer) {
+   std::string out;
+   lldp_intf_id_t intf_id = mgr->intf_id(peer);
+   std::string value(1, char(intf_id.encoding()));
+   put_field(out, FIELD_INTF_ID, value.append(intf_id.value()));
+   put_field(out, FIELD_INTF_DESCRIPTION, mgr->intf_description(peer));
+   put_uint_field(out, FIELD_DEFAULT_VLAN, mgr->default_vlan(peer), 2);
+   put_uint_field(out, FIELD_MAX_FRAME_SIZE, mgr->max_frame_size(peer), 4);
+   lldp_lacp_t lacp = mgr->lacp(peer);
+   value.assign(1, char(lacp.capable() | lacp.enabled() << 1 | lacp.valid() << 2));
+   put_uint(value, lacp.id(), 4);
+   put_field(out, FIELD_LACP, value);
+   lldp_phy_t phy = mgr->phy(peer);
+   value.assign(1, char(phy.autonegSupported() | phy.autonegEnabled() << 1 |
+                        phy.valid() << 2));
+   put_uint(value, phy.autonegCapabilitiesBm(), 2);
+   put_field(out, FIELD_PHY, value);
+   for(auto const & tlv : mgr->tlvs(peer)) {
+      std::string value;
+      put_uint(value, tlv.first.organization(), 4);
+      put_uint(value, tlv.first.subtype(), 1);
+      put_field(out, FIELD_TLV, value.append(tlv.second));
+   }
+   return out;
+}
+
+}  // namespace
+
+//
+// lldp_neighbor_info_t
+//
+
+lldp_neighbor_info_t::lldp_neighbor_info_t() {
+}
+
+lldp_neighbor_info_t::lldp_neighbor_info_t(
+      lldp_neighbor_t const & neighbor,
+      std::shared_ptr<std::string const> const & system,
+      std::shared_ptr<std::string const> const & port) :
+      neighbor_(neighbor), system_(system), port_(port) {
+}
+
+lldp_neighbor_t
+lldp_neighbor_info_t::neighbor() const {
+   return neighbor_;
+}
+
+lldp_chassis_id_t
+lldp_neighbor_info_t::chassis_id() const {
+   reader value;
+   if(!field_find(system_, FIELD_CHASSIS_ID, value)) {
+      return lldp_chassis_id_t();
+   }
+   auto encoding = lldp_chassis_id_encoding_t(value.uint(1));
+   return lldp_chassis_id_t(encoding, value.bytes(value.end - value.pos));
+}
+
+lldp_intf_id_t
+lldp_neighbor_info_t::intf_id() const {
+   reader value;
+   if(!field_find(port_, FIELD_INTF_ID, value)) {
+      return lldp_intf_id_t();
+   }
+   auto encoding = lldp_intf_id_encoding_t(value.uint(1));
+   return lldp_intf_id_t(encoding, value.bytes(value.end - value.pos));
+}
+
+std::string
+lldp_neighbor_info_t::intf_description() const {
+   return string_field(port_, FIELD_INTF_DESCRIPTION);
+}
+
+std::string
+lldp_neighbor_info_t::system_name() const {
+   return string_field(system_, FIELD_SYSTEM_NAME);
+}
+
+std::string
+lldp_neighbor_info_t::system_description() const {
+   return string_field(system_, FIELD_SYSTEM_DESCRIPTION);
+}
+
+lldp_syscap_t
+lldp_neighbor_info_t::system_capabilities() const {
+   return lldp_syscap_t(
+         lldp_syscap_bits_t(uint_field(system_, FIELD_SYSTEM_CAPABILITIES, 1)));
+}
+
+vlan_id_t
+lldp_neighbor_info_t::default_vlan() const {
+   return uint_field(port_, FIELD_DEFAULT_VLAN, 2);
+}
+
+vlan_id_t
+lldp_neighbor_info_t::management_vlan() const {
+   return uint_field(system_, FIELD_MANAGEMENT_VLAN, 2);
+}
+
+uint32_t
+lldp_neighbor_info_t::max_frame_size() const {
+   return uint_field(port_, FIELD_MAX_FRAME_SIZE, 4);
+}
+
+lldp_lacp_t
+lldp_neighbor_info_t::lacp() const {
+   reader value;
+   if(!field_find(port_, FIELD_LACP, value)) {
+      return lldp_lacp_t();
+   }
+   uint8_t flags = value.uint(1);
+   return lldp_lacp_t(flags & 1, flags & 2, value.uint(4), flags & 4);
+}
+
+lldp_phy_t
+lldp_neighbor_info_t::phy() const {
+   reader value;
+   if(!field_find(port_, FIELD_PHY, value)) {
+      return lldp_phy_t();
+   }
+   uint8_t flags = value.uint(1);
+   return lldp_phy_t(flags & 1, flags & 2, value.uint(2), flags & 4);
+}
+
+std::list<lldp_management_address_t>
+lldp_neighbor_info_t::management_address() const {
+   std::list<lldp_management_address_t> addresses;
+   fields_foreach(system_, FIELD_MANAGEMENT_ADDRESS, [&](reader value) {
+      uint32_t family = value.uint(4);
+      uint32_t ifindex = value.uint(4);
+      std::string address = value.bytes(value.varint());
+      std::string oid = value.bytes(value.end - value.pos);
+      addresses.push_back(lldp_management_address_t(family, address, ifindex,
+                                                     oid));
+   });
+   return addresses;
+}
+
+std::string
+lldp_neighbor_info_t::tlv(lldp_tlv_type_t tlv_type) const {
+   std::string payload;
+   fields_foreach(port_, FIELD_TLV, [&](reader value) {
+      if(value.uint(4) == tlv_type.organization() &&
+         value.uint(1) == tlv_type.subtype()) {
+         payload = value.bytes(value.end - value.pos);
+      }
+   });
+   return payload;
+}
+
+bool
+lldp_neighbor_info_t::tlv_exists(lldp_tlv_type_t tlv_type) const {
+   bool found = false;
+   fields_foreach(port_, FIELD_TLV, [&](reader value) {
+      found = found || (value.uint(4) == tlv_type.organization() &&
+                        value.uint(1) == tlv_type.subtype());
+   });
+   return found;
+}
+
+std::map<lldp_tlv_type_t, std::string>
+lldp_neighbor_info_t::tlvs() const {
+   std::map<lldp_tlv_type_t, std::string> tlvs;
+   fields_foreach(port_, FIELD_TLV, [&](reader value) {
+      uint32_t organization = value.uint(4);
+      uint8_t subtype = value.uint(1);
+      tlvs[lldp_tlv_type_t(organization, subtype)] =
+         value.bytes(value.end - value.pos);
+   });
+   return tlvs;
+}
+
+uint32_t
+lldp_neighbor_info_t::changed_fields(lldp_neighbor_info_t const & previous) const {
+   return blob_diff(system_, previous.system_) | blob_diff(port_, previous.port_);
+}
+
+//
+// lldp_neighbor_codec
+//
+
+uint32_t
+lldp_neighbor_codec::blob::hash() const {
+   hash_mix h;
+   h.mix(data);
+   return h.result();
+}
+
+bool
+lldp_neighbor_codec::blob::operator==(blob const & other) const {
+   return data == other.data;
+}
+
+std::shared_ptr<std::string const>
+lldp_neighbor_codec::intern(std::string const & data) {
+   std::shared_ptr<blob const> interned = blobs_.intern(blob{data});
+   return std::shared_ptr<std::string const>(interned, &interned->data);
+}
+
+lldp_neighbor_info_t
+lldp_neighbor_codec::read(lldp_mgr const * mgr, lldp_neighbor_t const & peer) {
+   return lldp_neighbor_info_t(peer, intern(system_encode(mgr, peer)),
+                               intern(port_encode(mgr, peer)));
+}
+
+}  // namespace eos
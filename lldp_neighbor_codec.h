@@ -0,0 +1,43 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_STUBS_LLDP_NEIGHBOR_CODEC_H
+#define EOS_STUBS_LLDP_NEIGHBOR_CODEC_H
+
+#include <memory>
+#include <string>
+
+#include "eos/lldp.h"
+#include "intern.h"
+
+namespace eos {
+
+/**
+ * Reads the information of LLDP neighbors into lldp_neighbor_info_t.
+ *
+ * The information of a neighbor is encoded as two blobs, one with the
+ * fields of the remote system and one with the fields of the remote port.
+ * Blobs are interned, so that the neighbors with the same remote system
+ * share its blob, and an unchanged neighbor reads back the blobs it had.
+ */
+class lldp_neighbor_codec {
+ public:
+   /// Reads and encodes the information of a neighbor.
+   lldp_neighbor_info_t read(lldp_mgr const * mgr, lldp_neighbor_t const & peer);
+
+ private:
+   struct blob {
+      std::string data;
+
+      uint32_t hash() const;
+      bool operator==(blob const & other) const;
+   };
+
+   std::shared_ptr<std::string const> intern(std::string const & data);
+
+   intern_table<blob> blobs_;
+};
+
+}
+
+#endif // EOS_STUBS_LLDP_NEIGHBOR_CODEC_H
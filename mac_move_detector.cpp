@@ -0,0 +1,319 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+
+#include "eos/mac_move_detector.h"
+#include "eos/timer.h"
+
+namespace eos {
+
+namespace {
+
+/// The number of sub-windows the sliding window is split into.
+static int const BUCKETS = 8;
+
+struct mac_key_hash {
+   size_t operator()(mac_key_t const & key) const {
+      return key.hash();
+   }
+};
+
+/// A tracked MAC.
+struct move_slot {
+   mac_key_t key;
+   // The moves in each sub-window, the latest one being `epoch`.
+   uint32_t buckets[BUCKETS];
+   int64_t epoch;
+   // The moves inherited from the MAC this slot was taken from, and the
+   // sub-window at which they were inherited.
+   uint32_t error;
+   int64_t error_epoch;
+   // The move count of the entry last reported by the MAC table manager.
+   uint32_t table_moves;
+   bool storm;
+};
+
+}  // namespace
+
+class mac_move_detector_internal {
+ public:
+   mac_move_detector_internal(size_t capacity, seconds_t window,
+                              uint32_t threshold) :
+         capacity(std::max<size_t>(capacity, 1)),
+         width(window > 0 ? window / BUCKETS : 1), threshold(threshold),
+         epoch(0), heap_epoch(0) {
+   }
+
+   /// Returns the moves of a slot in the window ending at the current epoch.
+   uint32_t moves(move_slot const & slot) const {
+      uint32_t count = 0;
+      int64_t first = std::max<int64_t>(std::max(slot.epoch, epoch) - BUCKETS + 1,
+                                        0);
+      for(int64_t e = first; e <= slot.epoch; ++e) {
+         count += slot.buckets[e % BUCKETS];
+      }
+      return count;
+   }
+
+   uint32_t error(move_slot const & slot) const {
+      return epoch - slot.error_epoch < BUCKETS ? slot.error : 0;
+   }
+
+   /// Returns the moves a slot is known to have made within the window.
+   uint32_t guaranteed_moves(move_slot const & slot) const {
+      uint32_t count = moves(slot);
+      uint32_t err = error(slot);
+      return count > err ? count - err : 0;
+   }
+
+   /**
+    * Updates whether a slot is over the threshold, returning true if it
+    * just reached it.
+    */
+   bool storm_update(move_slot & slot, uint32_t & moves) {
+      moves = guaranteed_moves(slot);
+      if(moves < threshold) {
+         slot.storm = false;
+         return false;
+      }
+      bool raise = !slot.storm;
+      slot.storm = true;
+      return raise;
+   }
+
+   move_slot const * lookup(mac_key_t const & key) const {
+      auto it = index.find(key);
+      return it != index.end() ? &slots[it->second] : NULL;
+   }
+
+   /**
+    * Records a move, returning the slot of the MAC. Returns NULL if the
+    * notification turns out not to be a move.
+    *
+    * A non-zero table_moves is the move count of the entry in the MAC table:
+    * only a change of that count is a move. The first notification of a MAC
+    * not tracked yet only seeds the count, as it is not known whether the
+    * count changed since the MAC was last seen.
+    */
+   move_slot * move_add(mac_key_t const & key, seconds_t when,
+                        uint32_t table_moves) {
+      epoch = std::max(epoch, int64_t(std::floor(when / width)));
+      move_slot * slot;
+      auto it = index.find(key);
+      if(it != index.end()) {
+         slot = &slots[it->second];
+         if(table_moves && slot->table_moves == table_moves) {
+            return NULL;
+         }
+      } else {
+         slot = slot_alloc(key);
+         if(table_moves) {
+            slot->table_moves = table_moves;
+            return NULL;
+         }
+      }
+      slot->table_moves = table_moves;
+      advance(*slot);
+      ++slot->buckets[epoch % BUCKETS];
+      heap_push(uint32_t(slot - &slots[0]));
+      return slot;
+   }
+
+   void clear() {
+      slots.clear();
+      index.clear();
+      heap.clear();
+   }
+
+   std::vector<move_slot> slots;
+   std::unordered_map<mac_key_t, uint32_t, mac_key_hash> index;
+   size_t capacity;
+   seconds_t width;
+   uint32_t threshold;
+   int64_t epoch;
+
+ private:
+   /// A slot and its moves when it was pushed on the heap.
+   typedef std::pair<uint32_t, uint32_t> heap_entry;
+
+   void heap_push(uint32_t index) {
+      if(heap.size() >= 2 * slots.size()) {
+         heap_build();
+         return;
+      }
+      heap.push_back(heap_entry(moves(slots[index]), index));
+      std::push_heap(heap.begin(), heap.end(), std::greater<heap_entry>());
+   }
+
+   void heap_build() {
+      heap.clear();
+      for(uint32_t i = 0; i < slots.size(); ++i) {
+         heap.push_back(heap_entry(moves(slots[i]), i));
+      }
+      std::make_heap(heap.begin(), heap.end(), std::greater<heap_entry>());
+      heap_epoch = epoch;
+   }
+
+   /**
+    * Returns the slot with the fewest moves, taking it off the heap.
+    *
+    * The heap holds the slots by move count, fewest first. Within a
+    * sub-window, the moves of a slot only grow, and each change pushes the
+    * slot again: an entry whose count is not the current one of its slot is
+    * stale and dropped. The moves of all slots drop as sub-windows leave
+    * the window, so the heap is rebuilt once per sub-window. It is also
+    * rebuilt when stale entries make up half of it.
+    */
+   uint32_t victim_pop() {
+      if(heap_epoch != epoch) {
+         heap_build();
+      }
+      for(;;) {
+         std::pop_heap(heap.begin(), heap.end(), std::greater<heap_entry>());
+         heap_entry top = heap.back();
+         heap.pop_back();
+         if(top.first == moves(slots[top.second])) {
+            return top.second;
+         }
+      }
+   }
+
+   /// Clears the sub-windows of a slot that fell out of the window.
+   void advance(move_slot & slot) {
+      int64_t stale = std::min<int64_t>(epoch - slot.epoch, BUCKETS);
+      for(int64_t i = 1; i <= stale; ++i) {
+         slot.buckets[(slot.epoch + i) % BUCKETS] = 0;
+      }
+      slot.epoch = epoch;
+   }
+
+   /**
+    * Returns a slot for a new MAC. Once all slots are used, the slot of the
+    * MAC with the fewest moves is taken over, along with its moves.
+    */
+   move_slot * slot_alloc(mac_key_t const & key) {
+      if(slots.size() < capacity) {
+         slots.push_back(move_slot());
+         move_slot & slot = slots.back();
+         std::fill(slot.buckets, slot.buckets + BUCKETS, 0);
+         slot.epoch = epoch;
+         slot.error = 0;
+         slot.error_epoch = epoch;
+         slot.key = key;
+         slot.table_moves = 0;
+         slot.storm = false;
+         index.emplace(key, slots.size() - 1);
+         heap_push(slots.size() - 1);
+         return &slot;
+      }
+      uint32_t victim = victim_pop();
+      uint32_t fewest = moves(slots[victim]);
+      move_slot & slot = slots[victim];
+      index.erase(slot.key);
+      advance(slot);
+      slot.error = fewest;
+      slot.error_epoch = epoch;
+      slot.key = key;
+      slot.table_moves = 0;
+      slot.storm = false;
+      index.emplace(key, victim);
+      heap_push(victim);
+      return &slot;
+   }
+
+   // The slots by move count, fewest first, see victim_pop().
+   std::vector<heap_entry> heap;
+   int64_t heap_epoch;
+};
+
+mac_move_detector_t::mac_move_detector_t(mac_table_mgr * mgr, size_t capacity,
+                                         seconds_t window, uint32_t threshold) :
+      mac_table_handler(mgr),
+      detector_(new mac_move_detector_internal(capacity, window, threshold)) {
+   watch_all_mac_entries(true);
+}
+
+mac_move_detector_t::~mac_move_detector_t() {
+   delete detector_;
+}
+
+void
+mac_move_detector_t::mac_move_add(mac_key_t const & key, seconds_t when) {
+   move_slot * slot = detector_->move_add(key, when, 0);
+   uint32_t moves;
+   if(detector_->storm_update(*slot, moves)) {
+      on_mac_move_storm(key, moves);
+   }
+}
+
+uint32_t
+mac_move_detector_t::mac_moves(mac_key_t const & key) const {
+   move_slot const * slot = detector_->lookup(key);
+   return slot ? detector_->moves(*slot) : 0;
+}
+
+uint32_t
+mac_move_detector_t::mac_moves_error(mac_key_t const & key) const {
+   move_slot const * slot = detector_->lookup(key);
+   return slot ? detector_->error(*slot) : 0;
+}
+
+bool
+mac_move_detector_t::mac_move_storm(mac_key_t const & key) const {
+   move_slot const * slot = detector_->lookup(key);
+   return slot && detector_->guaranteed_moves(*slot) >= detector_->threshold;
+}
+
+std::vector<std::pair<mac_key_t, uint32_t>>
+mac_move_detector_t::mac_top_movers(size_t count) const {
+   std::vector<std::pair<mac_key_t, uint32_t>> result;
+   result.reserve(detector_->slots.size());
+   for(auto const & slot : detector_->slots) {
+      uint32_t moves = detector_->moves(slot);
+      if(moves) {
+         result.push_back(std::make_pair(slot.key, moves));
+      }
+   }
+   count = std::min(count, result.size());
+   std::partial_sort(result.begin(), result.begin() + count, result.end(),
+                     [](std::pair<mac_key_t, uint32_t> const & a,
+                        std::pair<mac_key_t, uint32_t> const & b) {
+                        return a.second > b.second;
+                     });
+   result.resize(count);
+   return result;
+}
+
+void
+mac_move_detector_t::clear() {
+   detector_->clear();
+}
+
+void
+mac_move_detector_t::on_mac_move_storm(mac_key_t const & key, uint32_t moves) {
+}
+
+void
+mac_move_detector_t::on_mac_entry_set(mac_entry_t const & entry) {
+   mac_key_t key = entry.mac_key();
+   // The MAC table counts the moves of each entry: a notification without
+   // a new move is an entry being learned.
+   uint32_t table_moves = get_mac_table_mgr()->moves(key);
+   if(!table_moves) {
+      return;
+   }
+   move_slot * slot = detector_->move_add(key, now(), table_moves);
+   if(!slot) {
+      return;
+   }
+   uint32_t moves;
+   if(detector_->storm_update(*slot, moves)) {
+      on_mac_move_storm(key, moves);
+   }
+}
+
+}  // namespace eos
@@ -1,7 +1,10 @@
 // Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
+#include <map>
+
 #include "eos/mac_table.h"
+#include "eos/timer.h"
 #include "impl.h"
 
 namespace eos {
@@ -22,33 +25,70 @@ class mac_table_mgr_impl : public mac_table_mgr {
    }
 
    virtual mac_entry_t mac_entry_status(mac_key_t const & key) const {
-      return mac_entry_t();
+      // Configured entries are reported as learned right away.
+      return mac_entry(key);
    }
-   
+
    virtual mac_entry_t mac_entry(mac_key_t const & key) const {
-      return mac_entry_t();
+      auto it = entries_.find(key);
+      return it != entries_.end() ? it->second.entry : mac_entry_t();
    }
 
    virtual mac_entry_t mac_entry(vlan_id_t vlan, eth_addr_t mac) const {
-      return mac_entry_t();
+      return mac_entry(mac_key_t(vlan, mac));
    }
 
    virtual mac_entry_type_t type(mac_key_t const & key) const {
-      return mac_entry_type_t();
+      return entries_.count(key) ? MAC_ENTRY_CONFIGURED_STATIC : MAC_ENTRY_NULL;
    }
 
    virtual seconds_t last_move_time(mac_key_t const & key) const {
-      return 0;
+      auto it = entries_.find(key);
+      return it != entries_.end() ? it->second.last_move_time : 0;
    }
 
    virtual uint32_t moves(mac_key_t const & key) const {
-      return 0;
+      auto it = entries_.find(key);
+      return it != entries_.end() ? it->second.moves : 0;
+   }
+
+   virtual void mac_entry_set(mac_entry_t const & entry) {
+      mac_key_t key = entry.mac_key();
+      auto it = entries_.find(key);
+      if(it == entries_.end()) {
+         it = entries_.emplace(key, mac_status()).first;
+      } else if(it->second.entry.intfs() != entry.intfs()) {
+         ++it->second.moves;
+         it->second.last_move_time = now();
+      } else if(it->second.entry == entry) {
+         return;
+      }
+      it->second.entry = entry;
+      handler_foreach(key, [&entry](mac_table_handler * handler) {
+         handler->on_mac_entry_set(entry);
+      });
+   }
+
+   virtual void mac_entry_del(mac_key_t const & key) {
+      if(!entries_.erase(key)) {
+         return;
+      }
+      handler_foreach(key, [&key](mac_table_handler * handler) {
+         handler->on_mac_entry_del(key);
+      });
    }
 
-   virtual void mac_entry_set(mac_entry_t const & entry) {}
-   virtual void mac_entry_del(mac_key_t const & key) {}
+ private:
+   struct mac_status {
+      mac_status() : moves(0), last_move_time(0) {
+      }
 
+      mac_entry_t entry;
+      uint32_t moves;
+      seconds_t last_move_time;
+   };
 
+   std::map<mac_key_t, mac_status> entries_;
 };
 
 DEFINE_STUB_MGR_CTOR(mac_table_mgr)
@@ -56,8 +96,20 @@ DEFINE_STUB_MGR_CTOR(mac_table_mgr)
 mac_table_handler::mac_table_handler(mac_table_mgr *mgr) :
    base_handler(mgr) {
 }
-void mac_table_handler::watch_all_mac_entries(bool all) {}
-void mac_table_handler::watch_mac_entry(mac_key_t const & key, bool interest) {}
+void mac_table_handler::watch_all_mac_entries(bool all) {
+   if(all) {
+      mgr_->add_handler(this);
+   } else {
+      mgr_->remove_handler(this);
+   }
+}
+void mac_table_handler::watch_mac_entry(mac_key_t const & key, bool interest) {
+   if(interest) {
+      mgr_->add_handler(key, this);
+   } else {
+      mgr_->remove_handler(key, this);
+   }
+}
 
 void mac_table_handler::on_mac_entry_set(mac_entry_t const & entry) {}
 void mac_table_handler::on_mac_entry_del(mac_key_t const & key) {}
@@ -0,0 +1,418 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <set>
+#include <unordered_map>
+
+#include "eos/mac_table_cache.h"
+#include "eos/timer.h"
+
+namespace eos {
+
+namespace {
+
+static uint32_t const NONE = 0xffffffff;
+
+inline uint32_t mac_hash(vlan_id_t vlan, eth_addr_t const & eth_addr) {
+   uint64_t x = vlan;
+   for(int i = 0; i < 6; ++i) {
+      x = (x << 8) | eth_addr.byte(i);
+   }
+   x ^= x >> 33;
+   x *= 0xff51afd7ed558ccdULL;
+   x ^= x >> 33;
+   return uint32_t(x);
+}
+
+struct intf_hash {
+   size_t operator()(intf_id_t const & intf) const {
+      return intf.hash();
+   }
+};
+
+/// A cached MAC entry.
+struct mac_node {
+   mac_entry_t entry;
+   vlan_id_t vlan;
+   eth_addr_t eth_addr;
+   uint32_t hash;
+   // The position of the entry in the list of its VLAN, and in the list of
+   // each of its interfaces, in the order of entry.intfs().
+   uint32_t vlan_pos;
+   std::vector<uint32_t> intf_pos;
+   uint32_t moves;
+   seconds_t last_move_time;
+   // Links in the list of moved entries, ordered by last_move_time.
+   uint32_t move_prev;
+   uint32_t move_next;
+};
+
+/// A slot of the hash table, holding the index of a node.
+struct mac_slot {
+   uint32_t hash;
+   uint32_t node;
+};
+
+}  // namespace
+
+class mac_table_cache_internal {
+ public:
+   mac_table_cache_internal() : count(0), move_head(NONE), move_tail(NONE) {
+      slots.assign(16, mac_slot{0, NONE});
+   }
+
+   void clear() {
+      slots.assign(16, mac_slot{0, NONE});
+      nodes.clear();
+      free_nodes.clear();
+      by_vlan.clear();
+      by_intf.clear();
+      count = 0;
+      move_head = move_tail = NONE;
+   }
+
+   /// Returns the slot holding the given entry, or NONE.
+   uint32_t find(vlan_id_t vlan, eth_addr_t const & eth_addr,
+                 uint32_t hash) const {
+      uint32_t mask = slots.size() - 1;
+      for(uint32_t i = hash & mask;; i = (i + 1) & mask) {
+         mac_slot const & slot = slots[i];
+         if(slot.node == NONE) {
+            return NONE;
+         }
+         if(slot.hash == hash && nodes[slot.node].vlan == vlan &&
+            nodes[slot.node].eth_addr == eth_addr) {
+            return i;
+         }
+      }
+   }
+
+   mac_node const * lookup(mac_key_t const & key) const {
+      vlan_id_t vlan = key.vlan_id();
+      eth_addr_t eth_addr = key.eth_addr();
+      uint32_t slot = find(vlan, eth_addr, mac_hash(vlan, eth_addr));
+      return slot != NONE ? &nodes[slots[slot].node] : NULL;
+   }
+
+   void entry_set(mac_entry_t const & entry, uint32_t moves,
+                  seconds_t last_move_time) {
+      vlan_id_t vlan = entry.vlan_id();
+      eth_addr_t eth_addr = entry.eth_addr();
+      uint32_t hash = mac_hash(vlan, eth_addr);
+      uint32_t slot = find(vlan, eth_addr, hash);
+      if(slot == NONE) {
+         uint32_t node = node_alloc();
+         mac_node & n = nodes[node];
+         n.entry = entry;
+         n.vlan = vlan;
+         n.eth_addr = eth_addr;
+         n.hash = hash;
+         n.moves = moves;
+         n.last_move_time = 0;
+         n.move_prev = n.move_next = NONE;
+         slot_insert(hash, node);
+         index_add(node);
+         if(last_move_time) {
+            move_link(node, last_move_time);
+         }
+         return;
+      }
+      uint32_t node = slots[slot].node;
+      mac_node & n = nodes[node];
+      if(n.entry.intfs() == entry.intfs()) {
+         n.entry = entry;
+         return;
+      }
+      index_del(node);
+      n.entry = entry;
+      index_add(node);
+      n.moves = moves ? moves : n.moves + 1;
+      move_unlink(node);
+      move_link(node, last_move_time ? last_move_time : now());
+   }
+
+   void entry_del(mac_key_t const & key) {
+      vlan_id_t vlan = key.vlan_id();
+      eth_addr_t eth_addr = key.eth_addr();
+      uint32_t slot = find(vlan, eth_addr, mac_hash(vlan, eth_addr));
+      if(slot == NONE) {
+         return;
+      }
+      uint32_t node = slots[slot].node;
+      index_del(node);
+      move_unlink(node);
+      slot_erase(slot);
+      nodes[node].entry = mac_entry_t();
+      nodes[node].intf_pos.clear();
+      free_nodes.push_back(node);
+      --count;
+   }
+
+   std::vector<mac_entry_t> entries(std::vector<uint32_t> const * list) const {
+      std::vector<mac_entry_t> result;
+      if(list) {
+         result.reserve(list->size());
+         for(uint32_t node : *list) {
+            result.push_back(nodes[node].entry);
+         }
+      }
+      return result;
+   }
+
+   std::vector<uint32_t> const * vlan_list(vlan_id_t vlan) const {
+      auto it = by_vlan.find(vlan);
+      return it != by_vlan.end() ? &it->second : NULL;
+   }
+
+   std::vector<uint32_t> const * intf_list(intf_id_t intf) const {
+      auto it = by_intf.find(intf);
+      return it != by_intf.end() ? &it->second : NULL;
+   }
+
+   std::vector<mac_key_t> moved_since(seconds_t since) const {
+      std::vector<mac_key_t> result;
+      for(uint32_t node = move_tail;
+          node != NONE && nodes[node].last_move_time >= since;
+          node = nodes[node].move_prev) {
+         result.push_back(mac_key_t(nodes[node].vlan, nodes[node].eth_addr));
+      }
+      return result;
+   }
+
+   std::vector<mac_slot> slots;
+   std::vector<mac_node> nodes;
+   std::vector<uint32_t> free_nodes;
+   std::unordered_map<vlan_id_t, std::vector<uint32_t>> by_vlan;
+   std::unordered_map<intf_id_t, std::vector<uint32_t>, intf_hash> by_intf;
+   size_t count;
+   uint32_t move_head;
+   uint32_t move_tail;
+
+ private:
+   uint32_t node_alloc() {
+      ++count;
+      if(!free_nodes.empty()) {
+         uint32_t node = free_nodes.back();
+         free_nodes.pop_back();
+         return node;
+      }
+      nodes.emplace_back();
+      return nodes.size() - 1;
+   }
+
+   void slot_insert(uint32_t hash, uint32_t node) {
+      // Keep the table at most half full.
+      if(2 * count > slots.size()) {
+         std::vector<mac_slot> old(2 * slots.size(), mac_slot{0, NONE});
+         old.swap(slots);
+         for(auto const & slot : old) {
+            if(slot.node != NONE) {
+               slot_place(slot);
+            }
+         }
+      }
+      slot_place(mac_slot{hash, node});
+   }
+
+   void slot_place(mac_slot const & slot) {
+      uint32_t mask = slots.size() - 1;
+      uint32_t i = slot.hash & mask;
+      while(slots[i].node != NONE) {
+         i = (i + 1) & mask;
+      }
+      slots[i] = slot;
+   }
+
+   /**
+    * Empties a slot, shifting back the slots after it so that probing never
+    * stops short of an entry.
+    */
+   void slot_erase(uint32_t i) {
+      uint32_t mask = slots.size() - 1;
+      for(uint32_t j = (i + 1) & mask; slots[j].node != NONE; j = (j + 1) & mask) {
+         uint32_t home = slots[j].hash & mask;
+         // Move slot j into the hole at i, unless its home lies in (i, j].
+         if(((j - home) & mask) >= ((j - i) & mask)) {
+            slots[i] = slots[j];
+            i = j;
+         }
+      }
+      slots[i].node = NONE;
+   }
+
+   static void list_add(std::vector<uint32_t> & list, uint32_t node,
+                        uint32_t & pos) {
+      pos = list.size();
+      list.push_back(node);
+   }
+
+   void index_add(uint32_t node) {
+      mac_node & n = nodes[node];
+      list_add(by_vlan[n.vlan], node, n.vlan_pos);
+      std::set<intf_id_t> const & intfs = n.entry.intfs();
+      n.intf_pos.resize(intfs.size());
+      size_t i = 0;
+      for(auto const & intf : intfs) {
+         list_add(by_intf[intf], node, n.intf_pos[i++]);
+      }
+   }
+
+   void index_del(uint32_t node) {
+      mac_node & n = nodes[node];
+      auto vlan = by_vlan.find(n.vlan);
+      std::vector<uint32_t> & list = vlan->second;
+      uint32_t last = list.back();
+      list[n.vlan_pos] = last;
+      nodes[last].vlan_pos = n.vlan_pos;
+      list.pop_back();
+      if(list.empty()) {
+         by_vlan.erase(vlan);
+      }
+      size_t i = 0;
+      for(auto const & intf : n.entry.intfs()) {
+         auto it = by_intf.find(intf);
+         std::vector<uint32_t> & list = it->second;
+         uint32_t pos = n.intf_pos[i++];
+         uint32_t last = list.back();
+         list[pos] = last;
+         if(last != node) {
+            intf_pos_of(last, intf) = pos;
+         }
+         list.pop_back();
+         if(list.empty()) {
+            by_intf.erase(it);
+         }
+      }
+   }
+
+   uint32_t & intf_pos_of(uint32_t node, intf_id_t const & intf) {
+      mac_node & n = nodes[node];
+      size_t i = 0;
+      for(auto it = n.entry.intfs().begin(); *it != intf; ++it) {
+         ++i;
+      }
+      return n.intf_pos[i];
+   }
+
+   void move_link(uint32_t node, seconds_t time) {
+      mac_node & n = nodes[node];
+      n.last_move_time = time;
+      // Entries are linked in the order they moved; an older move time, as
+      // found on resync, is inserted in place.
+      uint32_t next = NONE;
+      uint32_t prev = move_tail;
+      while(prev != NONE && nodes[prev].last_move_time > time) {
+         next = prev;
+         prev = nodes[prev].move_prev;
+      }
+      n.move_prev = prev;
+      n.move_next = next;
+      (prev != NONE ? nodes[prev].move_next : move_head) = node;
+      (next != NONE ? nodes[next].move_prev : move_tail) = node;
+   }
+
+   void move_unlink(uint32_t node) {
+      mac_node & n = nodes[node];
+      if(n.move_prev == NONE && move_head != node) {
+         return;  // never moved
+      }
+      (n.move_prev != NONE ? nodes[n.move_prev].move_next : move_head) =
+         n.move_next;
+      (n.move_next != NONE ? nodes[n.move_next].move_prev : move_tail) =
+         n.move_prev;
+      n.move_prev = n.move_next = NONE;
+   }
+};
+
+mac_table_cache_t::mac_table_cache_t(mac_table_mgr * mgr) :
+      mac_table_handler(mgr), cache_(new mac_table_cache_internal()) {
+   watch_all_mac_entries(true);
+}
+
+mac_table_cache_t::~mac_table_cache_t() {
+   delete cache_;
+}
+
+void
+mac_table_cache_t::resync() {
+   mac_table_mgr * mgr = get_mac_table_mgr();
+   cache_->clear();
+   for(auto iter = mgr->mac_table_status_iter(); iter; ++iter) {
+      mac_entry_t entry = mgr->mac_entry_status(*iter);
+      if(!!entry) {
+         cache_->entry_set(entry, mgr->moves(*iter), mgr->last_move_time(*iter));
+      }
+   }
+}
+
+void
+mac_table_cache_t::clear() {
+   cache_->clear();
+}
+
+size_t
+mac_table_cache_t::size() const {
+   return cache_->count;
+}
+
+bool
+mac_table_cache_t::exists(mac_key_t const & key) const {
+   return cache_->lookup(key) != NULL;
+}
+
+mac_entry_t
+mac_table_cache_t::mac_entry(mac_key_t const & key) const {
+   mac_node const * node = cache_->lookup(key);
+   return node ? node->entry : mac_entry_t();
+}
+
+std::vector<mac_entry_t>
+mac_table_cache_t::mac_entries_by_vlan(vlan_id_t vlan) const {
+   return cache_->entries(cache_->vlan_list(vlan));
+}
+
+std::vector<mac_entry_t>
+mac_table_cache_t::mac_entries_by_intf(intf_id_t intf) const {
+   return cache_->entries(cache_->intf_list(intf));
+}
+
+size_t
+mac_table_cache_t::mac_count_by_vlan(vlan_id_t vlan) const {
+   auto list = cache_->vlan_list(vlan);
+   return list ? list->size() : 0;
+}
+
+size_t
+mac_table_cache_t::mac_count_by_intf(intf_id_t intf) const {
+   auto list = cache_->intf_list(intf);
+   return list ? list->size() : 0;
+}
+
+uint32_t
+mac_table_cache_t::moves(mac_key_t const & key) const {
+   mac_node const * node = cache_->lookup(key);
+   return node ? node->moves : 0;
+}
+
+seconds_t
+mac_table_cache_t::last_move_time(mac_key_t const & key) const {
+   mac_node const * node = cache_->lookup(key);
+   return node ? node->last_move_time : 0;
+}
+
+std::vector<mac_key_t>
+mac_table_cache_t::mac_entries_moved_since(seconds_t since) const {
+   return cache_->moved_since(since);
+}
+
+void
+mac_table_cache_t::on_mac_entry_set(mac_entry_t const & entry) {
+   cache_->entry_set(entry, 0, 0);
+}
+
+void
+mac_table_cache_t::on_mac_entry_del(mac_key_t const & key) {
+   cache_->entry_del(key);
+}
+
+}  // namespace eos
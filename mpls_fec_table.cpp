@@ -0,0 +1,98 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <algorithm>
+
+#include "mpls_fec_table.h"
+
+namespace eos {
+
+mpls_fec_table::mpls_fec_table() : next_id_(1) {
+}
+
+void
+mpls_fec_table::via_set_normalize(std::vector<mpls_route_via_t> & vias) {
+   for(auto & via : vias) {
+      via.route_key_is(mpls_route_key_t());
+   }
+   std::stable_sort(vias.begin(), vias.end(),
+                    [](mpls_route_via_t const & a, mpls_route_via_t const & b) {
+                       return a.hash() < b.hash();
+                    });
+   vias.erase(std::unique(vias.begin(), vias.end()), vias.end());
+}
+
+uint32_t
+mpls_fec_table::via_set_hash(std::vector<mpls_route_via_t> const & vias) {
+   uint32_t hash = uint32_t(vias.size());
+   for(auto const & via : vias) {
+      hash = hash * 31 + via.hash();
+   }
+   return hash;
+}
+
+bool
+mpls_fec_table::via_set_equal(std::vector<mpls_route_via_t> const & a,
+                              std::vector<mpls_route_via_t> const & b) {
+   // Vias with the same hash may be sorted in either order.
+   return a.size() == b.size() && std::is_permutation(a.begin(), a.end(), b.begin());
+}
+
+mpls_fec_id_t
+mpls_fec_table::fec_find(std::vector<mpls_route_via_t> const & vias,
+                         uint32_t hash) const {
+   auto range = by_hash_.equal_range(hash);
+   for(auto it = range.first; it != range.second; ++it) {
+      if(via_set_equal(fecs_.at(it->second).vias, vias)) {
+         return mpls_fec_id_t(it->second);
+      }
+   }
+   return mpls_fec_id_t();
+}
+
+mpls_fec_id_t
+mpls_fec_table::fec_add(std::vector<mpls_route_via_t> const & vias,
+                        uint32_t hash) {
+   uint64_t id = next_id_++;
+   fecs_[id] = fec{vias, hash, 0};
+   by_hash_.emplace(hash, id);
+   return mpls_fec_id_t(id);
+}
+
+void
+mpls_fec_table::fec_ref(mpls_fec_id_t const & fec) {
+   auto it = fecs_.find(fec.id());
+   if(it != fecs_.end()) {
+      ++it->second.refs;
+   }
+}
+
+bool
+mpls_fec_table::fec_unref(mpls_fec_id_t const & fec) {
+   auto it = fecs_.find(fec.id());
+   if(it == fecs_.end() || --it->second.refs) {
+      return false;
+   }
+   auto range = by_hash_.equal_range(it->second.hash);
+   for(auto by_hash = range.first; by_hash != range.second; ++by_hash) {
+      if(by_hash->second == fec.id()) {
+         by_hash_.erase(by_hash);
+         break;
+      }
+   }
+   fecs_.erase(it);
+   return true;
+}
+
+std::vector<mpls_route_via_t> const *
+mpls_fec_table::vias(mpls_fec_id_t const & fec) const {
+   auto it = fecs_.find(fec.id());
+   return it != fecs_.end() ? &it->second.vias : NULL;
+}
+
+size_t
+mpls_fec_table::size() const {
+   return fecs_.size();
+}
+
+}  // namespace eos
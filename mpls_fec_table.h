@@ -0,0 +1,63 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EOS_STUBS_MPLS_FEC_TABLE_H
+#define EOS_STUBS_MPLS_FEC_TABLE_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "eos/types/mpls_route.h"
+
+namespace eos {
+
+/**
+ * The MPLS FECs, each one a distinct set of vias shared by the routes
+ * forwarding to it.
+ *
+ * Via sets are normalized before lookup: the vias are unbound from their
+ * route and sorted by hash, so that the same vias given in any order, for
+ * any route, map to the same FEC.
+ */
+class mpls_fec_table {
+ public:
+   mpls_fec_table();
+
+   /// Unbinds the vias from their route and sorts them, removing duplicates.
+   static void via_set_normalize(std::vector<mpls_route_via_t> & vias);
+   /// The hash of a normalized via set.
+   static uint32_t via_set_hash(std::vector<mpls_route_via_t> const & vias);
+   /// Tests whether two normalized via sets have the same vias.
+   static bool via_set_equal(std::vector<mpls_route_via_t> const & a,
+                             std::vector<mpls_route_via_t> const & b);
+
+   /// Returns the FEC of a normalized via set, or an empty FEC ID if none.
+   mpls_fec_id_t fec_find(std::vector<mpls_route_via_t> const & vias,
+                          uint32_t hash) const;
+   /// Creates the FEC of a normalized via set, with no reference to it.
+   mpls_fec_id_t fec_add(std::vector<mpls_route_via_t> const & vias,
+                         uint32_t hash);
+   void fec_ref(mpls_fec_id_t const & fec);
+   /// Drops a reference to a FEC, returning true if the FEC was removed.
+   bool fec_unref(mpls_fec_id_t const & fec);
+
+   /// Returns the vias of a FEC, or NULL if unknown.
+   std::vector<mpls_route_via_t> const * vias(mpls_fec_id_t const & fec) const;
+   /// The number of FECs.
+   size_t size() const;
+
+ private:
+   struct fec {
+      std::vector<mpls_route_via_t> vias;
+      uint32_t hash;
+      uint32_t refs;
+   };
+
+   std::unordered_map<uint64_t, fec> fecs_;
+   std::unordered_multimap<uint32_t, uint64_t> by_hash_;
+   uint64_t next_id_;
+};
+
+}
+
+#endif // EOS_STUBS_MPLS_FEC_TABLE_H
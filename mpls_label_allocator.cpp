@@ -0,0 +1,381 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+
+#include "eos/exception.h"
+#include "eos/mpls_label_allocator.h"
+#include "eos/panic.h"
+
+namespace eos {
+
+static uint32_t const LABEL_FIRST_UNRESERVED = 16;
+static uint32_t const LABEL_SPACE = mpls_label_t::MAX + 1;
+static uint32_t const WORDS = LABEL_SPACE / 64;
+static uint32_t const SUMMARY_WORDS = WORDS / 64;
+static uint32_t const GROUP_WORDS = SUMMARY_WORDS / 64;
+
+static inline uint64_t
+bit(uint32_t index) {
+   return uint64_t(1) << (index & 63);
+}
+
+/// Returns the mask of the bits of word w covering labels first to last.
+static inline uint64_t
+word_mask(uint32_t w, uint32_t first, uint32_t last) {
+   uint32_t lo = std::max(first, w * 64) - w * 64;
+   uint32_t hi = std::min(last, w * 64 + 63) - w * 64;
+   return (~uint64_t(0) << lo) & (~uint64_t(0) >> (63 - hi));
+}
+
+/**
+ * The free labels are the set bits of free_. A bit of summary_ is set when
+ * the corresponding word of free_ has a free label, and a bit of group_
+ * when the corresponding word of summary_ is not zero, so that the lowest
+ * free label is found by one count of trailing zeros per level.
+ *
+ * The free labels are also indexed as runs of consecutive free labels, by
+ * first label and by length, so that a block of labels is taken from the
+ * shortest run long enough without walking the runs. All the changes to
+ * the free labels go through run_free() and run_use(), which keep the
+ * bitmap and the runs in step.
+ */
+class mpls_label_allocator_internal {
+ public:
+   mpls_label_allocator_internal() : size(0), allocated(0) {
+      std::fill(free_, free_ + WORDS, 0);
+      std::fill(summary_, summary_ + SUMMARY_WORDS, 0);
+      std::fill(group_, group_ + GROUP_WORDS, 0);
+   }
+
+   /// Frees the labels first to last, all in use, merging adjacent runs.
+   void run_free(uint32_t first, uint32_t last) {
+      span_free(first, last);
+      auto next = runs_.upper_bound(first);
+      if(next != runs_.end() && next->first == last + 1) {
+         last = next->second;
+         next = run_erase(next);
+      }
+      if(next != runs_.begin() && std::prev(next)->second + 1 == first) {
+         first = std::prev(next)->first;
+         run_erase(std::prev(next));
+      }
+      run_insert(first, last);
+   }
+
+   /// Uses the labels first to last, all in the same free run.
+   void run_use(uint32_t first, uint32_t last) {
+      span_use(first, last);
+      auto it = std::prev(runs_.upper_bound(first));
+      uint32_t run_first = it->first;
+      uint32_t run_last = it->second;
+      run_erase(it);
+      if(run_first < first) {
+         run_insert(run_first, first - 1);
+      }
+      if(last < run_last) {
+         run_insert(last + 1, run_last);
+      }
+   }
+
+   /**
+    * Returns the first label of the shortest run of at least count free
+    * labels, the lowest one among runs of the same length, or LABEL_SPACE.
+    */
+   uint32_t run_find(uint32_t count) const {
+      auto it = run_lengths_.lower_bound(std::make_pair(count, uint32_t(0)));
+      return it != run_lengths_.end() ? it->second : LABEL_SPACE;
+   }
+
+   bool is_free(uint32_t label) const {
+      return free_[label / 64] & bit(label);
+   }
+
+   /// Returns the first free label from a label, or LABEL_SPACE.
+   uint32_t free_next(uint32_t label) const {
+      uint32_t w = label / 64;
+      uint64_t bits = free_[w] & (~uint64_t(0) << (label & 63));
+      if(!bits) {
+         w = word_next(w + 1);
+         if(w == WORDS) {
+            return LABEL_SPACE;
+         }
+         bits = free_[w];
+      }
+      return w * 64 + __builtin_ctzll(bits);
+   }
+
+   /// Returns the first allocated or unconfigured label from a label.
+   uint32_t used_next(uint32_t label) const {
+      uint32_t w = label / 64;
+      uint64_t bits = ~free_[w] & (~uint64_t(0) << (label & 63));
+      while(!bits) {
+         if(++w == WORDS) {
+            return LABEL_SPACE;
+         }
+         bits = ~free_[w];
+      }
+      return w * 64 + __builtin_ctzll(bits);
+   }
+
+   bool in_range(uint32_t label) const {
+      auto it = ranges.upper_bound(label);
+      return it != ranges.begin() && (--it)->second >= label;
+   }
+
+   /// The configured ranges, merged, from first to last label.
+   std::map<uint32_t, uint32_t> ranges;
+   uint32_t size;
+   uint32_t allocated;
+
+ private:
+   typedef std::map<uint32_t, uint32_t>::iterator run_iter;
+
+   void run_insert(uint32_t first, uint32_t last) {
+      runs_[first] = last;
+      run_lengths_.insert(std::make_pair(last - first + 1, first));
+   }
+
+   run_iter run_erase(run_iter it) {
+      run_lengths_.erase(std::make_pair(it->second - it->first + 1, it->first));
+      return runs_.erase(it);
+   }
+
+   void free_set(uint32_t w, uint64_t mask) {
+      if(!free_[w] && mask) {
+         uint32_t s = w / 64;
+         if(!summary_[s]) {
+            group_[s / 64] |= bit(s);
+         }
+         summary_[s] |= bit(w);
+      }
+      free_[w] |= mask;
+   }
+
+   void free_clear(uint32_t w, uint64_t mask) {
+      if(!free_[w]) {
+         return;
+      }
+      free_[w] &= ~mask;
+      if(!free_[w]) {
+         uint32_t s = w / 64;
+         summary_[s] &= ~bit(w);
+         if(!summary_[s]) {
+            group_[s / 64] &= ~bit(s);
+         }
+      }
+   }
+
+   void span_free(uint32_t first, uint32_t last) {
+      for(uint32_t w = first / 64; w <= last / 64; ++w) {
+         free_set(w, word_mask(w, first, last));
+      }
+   }
+
+   void span_use(uint32_t first, uint32_t last) {
+      for(uint32_t w = first / 64; w <= last / 64; ++w) {
+         free_clear(w, word_mask(w, first, last));
+      }
+   }
+
+   /// Returns the first word with a free label from word w, or WORDS.
+   uint32_t word_next(uint32_t w) const {
+      if(w >= WORDS) {
+         return WORDS;
+      }
+      uint32_t s = w / 64;
+      uint64_t bits = summary_[s] & (~uint64_t(0) << (w & 63));
+      if(bits) {
+         return s * 64 + __builtin_ctzll(bits);
+      }
+      for(uint32_t next = s + 1; next < SUMMARY_WORDS;) {
+         uint32_t g = next / 64;
+         bits = group_[g] & (~uint64_t(0) << (next & 63));
+         if(bits) {
+            s = g * 64 + __builtin_ctzll(bits);
+            return s * 64 + __builtin_ctzll(summary_[s]);
+         }
+         next = (g + 1) * 64;
+      }
+      return WORDS;
+   }
+
+   /// The free runs, from first to last label.
+   std::map<uint32_t, uint32_t> runs_;
+   /// The free runs, as length and first label.
+   std::set<std::pair<uint32_t, uint32_t>> run_lengths_;
+   uint64_t free_[WORDS];
+   uint64_t summary_[SUMMARY_WORDS];
+   uint64_t group_[GROUP_WORDS];
+};
+
+mpls_label_allocator_t::mpls_label_allocator_t() :
+      allocator_(new mpls_label_allocator_internal()) {
+}
+
+mpls_label_allocator_t::~mpls_label_allocator_t() {
+   delete allocator_;
+}
+
+void
+mpls_label_allocator_t::range_add(mpls_label_t first, mpls_label_t last) {
+   if(last < first) {
+      panic(invalid_argument_error("last", "must not be lower than first"));
+   }
+   uint32_t lo = std::max(first.label(), LABEL_FIRST_UNRESERVED);
+   uint32_t hi = std::min(last.label(), uint32_t(mpls_label_t::MAX));
+   if(lo > hi) {
+      return;
+   }
+   auto & ranges = allocator_->ranges;
+   // Free the labels of [lo, hi] not in a range yet, and merge the ranges
+   // overlapping or adjacent to it.
+   auto it = ranges.upper_bound(lo);
+   if(it != ranges.begin() && std::prev(it)->second + 1 >= lo) {
+      --it;
+   }
+   uint32_t merged_lo = lo;
+   uint32_t merged_hi = hi;
+   uint32_t cursor = lo;
+   while(it != ranges.end() && it->first <= hi + 1) {
+      if(it->first > cursor) {
+         allocator_->run_free(cursor, it->first - 1);
+         allocator_->size += it->first - cursor;
+      }
+      cursor = std::max(cursor, it->second + 1);
+      merged_lo = std::min(merged_lo, it->first);
+      merged_hi = std::max(merged_hi, it->second);
+      it = ranges.erase(it);
+   }
+   if(cursor <= hi) {
+      allocator_->run_free(cursor, hi);
+      allocator_->size += hi - cursor + 1;
+   }
+   ranges[merged_lo] = merged_hi;
+}
+
+uint32_t
+mpls_label_allocator_t::size() const {
+   return allocator_->size;
+}
+
+uint32_t
+mpls_label_allocator_t::allocated_count() const {
+   return allocator_->allocated;
+}
+
+mpls_label_t
+mpls_label_allocator_t::label_alloc() {
+   uint32_t label = allocator_->free_next(0);
+   if(label == LABEL_SPACE) {
+      return mpls_label_t();
+   }
+   allocator_->run_use(label, label);
+   ++allocator_->allocated;
+   return mpls_label_t(label);
+}
+
+mpls_label_t
+mpls_label_allocator_t::label_range_alloc(uint32_t count) {
+   if(!count || count > allocator_->size - allocator_->allocated) {
+      return mpls_label_t();
+   }
+   uint32_t label = allocator_->run_find(count);
+   if(label == LABEL_SPACE) {
+      return mpls_label_t();
+   }
+   allocator_->run_use(label, label + count - 1);
+   allocator_->allocated += count;
+   return mpls_label_t(label);
+}
+
+bool
+mpls_label_allocator_t::label_reserve(mpls_label_t label) {
+   if(!label || !allocator_->is_free(label.label())) {
+      return false;
+   }
+   allocator_->run_use(label.label(), label.label());
+   ++allocator_->allocated;
+   return true;
+}
+
+bool
+mpls_label_allocator_t::label_free(mpls_label_t label) {
+   if(!allocated(label)) {
+      return false;
+   }
+   allocator_->run_free(label.label(), label.label());
+   --allocator_->allocated;
+   return true;
+}
+
+void
+mpls_label_allocator_t::label_range_free(mpls_label_t first, uint32_t count) {
+   uint32_t label = first.label();
+   if(label >= LABEL_SPACE) {
+      return;
+   }
+   // Clamp the count first, so that label + count cannot wrap around.
+   uint32_t last = label + std::min(count, LABEL_SPACE - label);
+   for(; label < last; ++label) {
+      label_free(mpls_label_t(label));
+   }
+}
+
+bool
+mpls_label_allocator_t::allocated(mpls_label_t label) const {
+   return label.label() < LABEL_SPACE && !allocator_->is_free(label.label()) &&
+          allocator_->in_range(label.label());
+}
+
+std::vector<mpls_label_t>
+mpls_label_allocator_t::leaked_labels(
+      std::vector<mpls_label_t> const & in_use) const {
+   std::vector<uint32_t> used;
+   used.reserve(in_use.size());
+   for(auto const & label : in_use) {
+      used.push_back(label.label());
+   }
+   std::sort(used.begin(), used.end());
+   auto next_used = used.begin();
+
+   std::vector<mpls_label_t> result;
+   for(auto const & range : allocator_->ranges) {
+      uint32_t label = range.first;
+      while(label <= range.second) {
+         label = allocator_->used_next(label);
+         if(label > range.second) {
+            break;
+         }
+         next_used = std::lower_bound(next_used, used.end(), label);
+         if(next_used == used.end() || *next_used != label) {
+            result.push_back(mpls_label_t(label));
+         }
+         ++label;
+      }
+   }
+   return result;
+}
+
+std::vector<mpls_label_t>
+mpls_label_allocator_t::leaked_labels(
+      mpls_route_mgr * route_mgr,
+      mpls_vrf_label_mgr * vrf_label_mgr) const {
+   std::vector<mpls_label_t> in_use;
+   if(route_mgr) {
+      for(auto iter = route_mgr->mpls_route_iter(); iter; ++iter) {
+         in_use.push_back(iter->key().top_label());
+      }
+   }
+   if(vrf_label_mgr) {
+      for(auto iter = vrf_label_mgr->mpls_vrf_label_iter(); iter; ++iter) {
+         in_use.push_back(iter->label());
+      }
+   }
+   return leaked_labels(in_use);
+}
+
+}  // namespace eos
@@ -1,8 +1,14 @@
 // Copyright (c) 2013 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
+#include <algorithm>
+#include <map>
+#include <set>
+
 #include "eos/mpls_route.h"
+#include "eos/mpls_route_bulk.h"
 #include "impl.h"
+#include "mpls_fec_table.h"
 
 namespace eos {
 
@@ -30,19 +36,64 @@ class mpls_route_mgr_impl : public mpls_route_mgr {
    }
 
    bool exists(mpls_route_key_t const & route_key) const {
-      return false;  // TODO: No op impl.
+      return routes_.count(route_key) != 0;
    }
 
    bool exists(mpls_route_via_t const & route_via) const {
-      return false;  // TODO: No op impl.
+      auto vias = vias_.find(route_via.route_key());
+      return vias != vias_.end() &&
+             std::find(vias->second.begin(), vias->second.end(), route_via) !=
+                vias->second.end();
    }
 
    void mpls_route_set(mpls_route_t const & route) {
-      // TODO: No op impl.
+      routes_[route.key()] = route;
    }
 
    void mpls_route_via_set(mpls_route_via_t const & route_via) {
-      // TODO: No op impl.
+      // A via of a route that is not set would hold a FEC that
+      // mpls_route_del() never releases.
+      if(!routes_.count(route_via.route_key())) {
+         return;
+      }
+      auto & vias = vias_[route_via.route_key()];
+      if(std::find(vias.begin(), vias.end(), route_via) == vias.end()) {
+         vias.push_back(route_via);
+         fec_update(route_via.route_key());
+      }
+   }
+
+   void mpls_routes_set(mpls_route_batch_t const & batch,
+                        mpls_route_batch_result_t & result) {
+      // The FEC of each via set of the batch, looked up on first use.
+      std::vector<mpls_fec_id_t> via_set_fecs(batch.via_set_count());
+      fec_changes changes;
+      for(size_t row = 0; row < batch.size(); ++row) {
+         mpls_route_t const & route = batch.route(row);
+         mpls_route_key_t key = route.key();
+         size_t index = batch.via_set_index(row);
+         std::vector<mpls_route_via_t> const & via_set = batch.via_set(index);
+         mpls_route_set_result_t status = route_validate(key, via_set);
+         if(status != MPLS_ROUTE_SET_OK) {
+            result.result_add(key, status, mpls_fec_id_t());
+            continue;
+         }
+         routes_[key] = route;
+         auto & vias = vias_[key];
+         vias = via_set;
+         for(auto & via : vias) {
+            via.route_key_is(key);
+         }
+         // A FEC looked up for an earlier row is removed if the routes
+         // using it moved to other vias since.
+         mpls_fec_id_t & fec = via_set_fecs[index];
+         if(!fec.id() || !fecs_.vias(fec)) {
+            fec = fec_lookup(via_set, changes);
+         }
+         fec_bind(key, fec, changes);
+         result.result_add(key, MPLS_ROUTE_SET_OK, fec);
+      }
+      fec_notify(changes);
    }
 
    void mpls_route_backup_via_set(mpls_route_via_t const & route_via) {
@@ -50,11 +101,40 @@ class mpls_route_mgr_impl : public mpls_route_mgr {
    }
 
    void mpls_route_del(mpls_route_key_t const & route_key) {
-      // TODO: No op impl.
+      if(!routes_.erase(route_key)) {
+         return;
+      }
+      vias_.erase(route_key);
+      auto fec = route_fecs_.find(route_key);
+      if(fec == route_fecs_.end()) {
+         return;
+      }
+      mpls_fec_id_t old_fec = fec->second;
+      route_fecs_.erase(fec);
+      bool fec_removed = fecs_.fec_unref(old_fec);
+      route_handler_foreach(route_key, [&](mpls_route_handler * handler) {
+         handler->on_mpls_route_del(route_key);
+         if(route_key.labels().size() == 1) {
+            handler->on_mpls_route_del(route_key.top_label());
+         }
+      });
+      if(fec_removed) {
+         handler_foreach([&](mpls_route_handler * handler) {
+            handler->on_mpls_fec_del(old_fec);
+         });
+      }
    }
 
    void mpls_route_via_del(mpls_route_via_t const & route_via) {
-      // TODO: No op impl.
+      auto vias = vias_.find(route_via.route_key());
+      if(vias == vias_.end()) {
+         return;
+      }
+      auto via = std::find(vias->second.begin(), vias->second.end(), route_via);
+      if(via != vias->second.end()) {
+         vias->second.erase(via);
+         fec_update(route_via.route_key());
+      }
    }
 
    void mpls_route_backup_via_del(mpls_route_via_t const & route_via) {
@@ -92,11 +172,20 @@ class mpls_route_mgr_impl : public mpls_route_mgr {
 
    mpls_fec_id_t
    fec_id(mpls_label_t label) const {
-      return mpls_fec_id_t();
+      return fec_id(mpls_route_key_t(label, 0));
    }
 
    mpls_fec_id_t
    fec_id(mpls_route_key_t const & route_key) const {
+      // The metric is not used: return the FEC of the route with the label
+      // stack of the key and the lowest metric, the first in key order.
+      mpls_route_key_t first_key(route_key);
+      first_key.metric_is(0);
+      auto fec = route_fecs_.lower_bound(first_key);
+      if(fec != route_fecs_.end() &&
+         fec->first.labels() == route_key.labels()) {
+         return fec->second;
+      }
       return mpls_fec_id_t();
    }
 
@@ -109,6 +198,139 @@ class mpls_route_mgr_impl : public mpls_route_mgr {
    metric(mpls_route_key_t const & route_key) const {
       return 0;
    }
+
+ private:
+   /// The FECs created, routes rebound and FECs removed by an update.
+   struct fec_changes {
+      std::vector<mpls_fec_id_t> created;
+      std::vector<std::pair<mpls_route_key_t, mpls_fec_id_t>> routes;
+      std::vector<mpls_fec_id_t> removed;
+   };
+
+   static mpls_route_set_result_t
+   route_validate(mpls_route_key_t const & key,
+                  std::vector<mpls_route_via_t> const & vias) {
+      if(key.labels().empty()) {
+         return MPLS_ROUTE_SET_INVALID_KEY;
+      }
+      for(auto const & label : key.labels()) {
+         if(!label) {
+            return MPLS_ROUTE_SET_INVALID_KEY;
+         }
+      }
+      for(auto const & via : vias) {
+         if(via.label_action() == MPLS_ACTION_NULL) {
+            return MPLS_ROUTE_SET_INVALID_VIA;
+         }
+      }
+      return MPLS_ROUTE_SET_OK;
+   }
+
+   /// Points a route to a FEC, or to none if the FEC ID is empty.
+   void fec_bind(mpls_route_key_t const & key, mpls_fec_id_t const & fec,
+                 fec_changes & changes) {
+      auto it = route_fecs_.find(key);
+      mpls_fec_id_t old_fec = it != route_fecs_.end() ? it->second : mpls_fec_id_t();
+      if(old_fec == fec) {
+         return;
+      }
+      // Take the new reference first, so that a FEC moving between routes
+      // is never removed.
+      if(fec.id()) {
+         fecs_.fec_ref(fec);
+         route_fecs_[key] = fec;
+      } else {
+         route_fecs_.erase(key);
+      }
+      if(old_fec.id() && fecs_.fec_unref(old_fec)) {
+         changes.removed.push_back(old_fec);
+      }
+      changes.routes.push_back(std::make_pair(key, fec));
+   }
+
+   /**
+    * Returns the FEC of a normalized via set, creating it if needed, or an
+    * empty FEC ID if the set is empty.
+    */
+   mpls_fec_id_t fec_lookup(std::vector<mpls_route_via_t> const & via_set,
+                            fec_changes & changes) {
+      if(via_set.empty()) {
+         return mpls_fec_id_t();
+      }
+      uint32_t hash = mpls_fec_table::via_set_hash(via_set);
+      mpls_fec_id_t fec = fecs_.fec_find(via_set, hash);
+      if(!fec.id()) {
+         fec = fecs_.fec_add(via_set, hash);
+         changes.created.push_back(fec);
+      }
+      return fec;
+   }
+
+   /// Rebinds a route to the FEC of its vias after a via changed.
+   void fec_update(mpls_route_key_t const & key) {
+      fec_changes changes;
+      std::vector<mpls_route_via_t> via_set(vias_[key]);
+      mpls_fec_table::via_set_normalize(via_set);
+      fec_bind(key, fec_lookup(via_set, changes), changes);
+      fec_notify(changes);
+   }
+
+   /**
+    * Runs f for each handler watching the route: the handlers registered on
+    * its key, and for a single-label route, the handlers watching its label,
+    * which are registered on the key of metric 0. Each handler is run once.
+    */
+   template <typename Func>
+   void route_handler_foreach(mpls_route_key_t const & key, Func f) {
+      std::set<mpls_route_handler *> notified;
+      handler_foreach(key, [&](mpls_route_handler * handler) {
+         notified.insert(handler);
+         f(handler);
+      });
+      if(key.labels().size() != 1 || !key.metric()) {
+         return;
+      }
+      handler_foreach(mpls_route_key_t(key.top_label(), 0),
+                      [&](mpls_route_handler * handler) {
+         if(!notified.count(handler)) {
+            f(handler);
+         }
+      });
+   }
+
+   void fec_notify(fec_changes const & changes) {
+      for(auto const & fec : changes.created) {
+         handler_foreach([&](mpls_route_handler * handler) {
+            handler->on_mpls_fec_set(fec);
+         });
+      }
+      for(auto const & route : changes.routes) {
+         mpls_route_key_t const & key = route.first;
+         route_handler_foreach(key, [&](mpls_route_handler * handler) {
+            if(route.second.id()) {
+               handler->on_mpls_route_set(key, route.second);
+               if(key.labels().size() == 1) {
+                  handler->on_mpls_route_set(key.top_label(), route.second);
+               }
+            } else {
+               handler->on_mpls_route_del(key);
+               if(key.labels().size() == 1) {
+                  handler->on_mpls_route_del(key.top_label());
+               }
+            }
+         });
+      }
+      for(auto const & fec : changes.removed) {
+         handler_foreach([&](mpls_route_handler * handler) {
+            handler->on_mpls_fec_del(fec);
+         });
+      }
+   }
+
+   std::map<mpls_route_key_t, mpls_route_t> routes_;
+   std::map<mpls_route_key_t, std::vector<mpls_route_via_t>> vias_;
+   std::map<mpls_route_key_t, mpls_fec_id_t> route_fecs_;
+   mpls_fec_table fecs_;
 };
 
 // -- pimpl wrappers to mpls_route_backup functions
@@ -127,6 +349,11 @@ void mpls_route_mgr::mpls_route_backup_via_del(mpls_route_via_t const& via) {
    return static_cast<mpls_route_mgr_impl*>(this)->mpls_route_backup_via_del(via);
 }
 
+void mpls_route_mgr::mpls_routes_set(mpls_route_batch_t const & batch,
+                                     mpls_route_batch_result_t & result) {
+   return static_cast<mpls_route_mgr_impl*>(this)->mpls_routes_set(batch, result);
+}
+
 // -- end of wrappers
 
 DEFINE_STUB_MGR_CTOR(mpls_route_mgr)
@@ -134,10 +361,26 @@ DEFINE_STUB_MGR_CTOR(mpls_route_mgr)
 mpls_route_handler::mpls_route_handler(mpls_route_mgr *mgr) : base_handler(mgr) {
 }
 
-void mpls_route_handler::watch_all_mpls_routes(bool) {}
-void mpls_route_handler::watch_mpls_route(mpls_label_t const &label, bool) {}
+void mpls_route_handler::watch_all_mpls_routes(bool should_watch) {
+   if(should_watch) {
+      mgr_->add_handler(this);
+   } else {
+      mgr_->remove_handler(this);
+   }
+}
+void mpls_route_handler::watch_mpls_route(mpls_label_t const &label,
+                                          bool should_watch) {
+   // Label watches are kept under the single-label key of metric 0.
+   watch_mpls_route(mpls_route_key_t(label, 0), should_watch);
+}
 void mpls_route_handler::watch_mpls_route(mpls_route_key_t const & route_key,
-                                          bool) {}
+                                          bool should_watch) {
+   if(should_watch) {
+      mgr_->add_handler(route_key, this);
+   } else {
+      mgr_->remove_handler(route_key, this);
+   }
+}
 
 void mpls_route_handler::on_mpls_route_set(mpls_label_t label, mpls_fec_id_t) {}
 void mpls_route_handler::on_mpls_route_set(mpls_route_key_t const & route_key,
@@ -0,0 +1,115 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <algorithm>
+
+#include "eos/mpls_route_bulk.h"
+#include "mpls_fec_table.h"
+
+namespace eos {
+
+mpls_route_batch_t::mpls_route_batch_t() {
+}
+
+void
+mpls_route_batch_t::clear() {
+   routes_.clear();
+   route_via_sets_.clear();
+   via_sets_.clear();
+   via_set_index_.clear();
+}
+
+void
+mpls_route_batch_t::route_set(mpls_route_t const & route,
+                              std::vector<mpls_route_via_t> const & vias) {
+   std::vector<mpls_route_via_t> via_set(vias);
+   mpls_fec_table::via_set_normalize(via_set);
+   uint32_t hash = mpls_fec_table::via_set_hash(via_set);
+
+   uint32_t index = uint32_t(via_sets_.size());
+   auto range = via_set_index_.equal_range(hash);
+   for(auto it = range.first; it != range.second; ++it) {
+      if(mpls_fec_table::via_set_equal(via_sets_[it->second], via_set)) {
+         index = it->second;
+         break;
+      }
+   }
+   if(index == via_sets_.size()) {
+      via_sets_.push_back(std::move(via_set));
+      via_set_index_.emplace(hash, index);
+   }
+   routes_.push_back(route);
+   route_via_sets_.push_back(index);
+}
+
+size_t
+mpls_route_batch_t::size() const {
+   return routes_.size();
+}
+
+mpls_route_t const &
+mpls_route_batch_t::route(size_t row) const {
+   return routes_[row];
+}
+
+size_t
+mpls_route_batch_t::via_set_index(size_t row) const {
+   return route_via_sets_[row];
+}
+
+size_t
+mpls_route_batch_t::via_set_count() const {
+   return via_sets_.size();
+}
+
+std::vector<mpls_route_via_t> const &
+mpls_route_batch_t::via_set(size_t index) const {
+   return via_sets_[index];
+}
+
+mpls_route_batch_result_t::mpls_route_batch_result_t() {
+}
+
+void
+mpls_route_batch_result_t::clear() {
+   keys_.clear();
+   results_.clear();
+   fecs_.clear();
+}
+
+void
+mpls_route_batch_result_t::result_add(mpls_route_key_t const & key,
+                                      mpls_route_set_result_t result,
+                                      mpls_fec_id_t const & fec) {
+   keys_.push_back(key);
+   results_.push_back(result);
+   fecs_.push_back(fec);
+}
+
+size_t
+mpls_route_batch_result_t::size() const {
+   return keys_.size();
+}
+
+mpls_route_key_t const &
+mpls_route_batch_result_t::key(size_t row) const {
+   return keys_[row];
+}
+
+mpls_route_set_result_t
+mpls_route_batch_result_t::result(size_t row) const {
+   return results_[row];
+}
+
+mpls_fec_id_t const &
+mpls_route_batch_result_t::fec_id(size_t row) const {
+   return fecs_[row];
+}
+
+size_t
+mpls_route_batch_result_t::failed_count() const {
+   return results_.size() - std::count(results_.begin(), results_.end(),
+                                       MPLS_ROUTE_SET_OK);
+}
+
+}  // namespace eos
@@ -0,0 +1,275 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include "eos/mpls_route_reconciler.h"
+#include "eos/timer.h"
+#include "mpls_fec_table.h"
+
+namespace eos {
+
+class mpls_route_reconciler_internal {
+ public:
+   struct state {
+      mpls_route_discrepancy_t discrepancy;
+      seconds_t since;
+   };
+
+   explicit mpls_route_reconciler_internal(mpls_route_reconciler_t * reconciler)
+         : reconciler(reconciler) {
+   }
+
+   mpls_route_mgr * mgr() const {
+      return reconciler->get_mpls_route_mgr();
+   }
+
+   std::vector<mpls_route_via_t> config_vias(mpls_route_key_t const & key) const {
+      std::vector<mpls_route_via_t> vias;
+      for(auto iter = mgr()->mpls_route_via_iter(key); iter; ++iter) {
+         vias.push_back(*iter);
+      }
+      mpls_fec_table::via_set_normalize(vias);
+      return vias;
+   }
+
+   std::vector<mpls_route_via_t> status_vias(mpls_route_key_t const & key) const {
+      std::vector<mpls_route_via_t> vias;
+      for(auto iter = mgr()->mpls_route_via_status_iter(key); iter; ++iter) {
+         vias.push_back(*iter);
+      }
+      mpls_fec_table::via_set_normalize(vias);
+      return vias;
+   }
+
+   /// Classifies a route from whether it is configured and programmed.
+   mpls_route_discrepancy_t classify(mpls_route_key_t const & key,
+                                     bool configured, bool programmed) const {
+      if(!configured) {
+         return programmed ? MPLS_ROUTE_DISCREPANCY_EXTRA
+                           : MPLS_ROUTE_DISCREPANCY_NONE;
+      }
+      // A route without vias is not expected in hardware.
+      std::vector<mpls_route_via_t> vias = config_vias(key);
+      if(!programmed) {
+         return vias.empty() ? MPLS_ROUTE_DISCREPANCY_NONE
+                             : MPLS_ROUTE_DISCREPANCY_MISSING;
+      }
+      return mpls_fec_table::via_set_equal(vias, status_vias(key))
+             ? MPLS_ROUTE_DISCREPANCY_NONE : MPLS_ROUTE_DISCREPANCY_MISMATCHED;
+   }
+
+   void discrepancy_is(mpls_route_key_t const & key,
+                       mpls_route_discrepancy_t discrepancy) {
+      auto it = states.find(key);
+      mpls_route_discrepancy_t previous = it != states.end()
+         ? it->second.discrepancy : MPLS_ROUTE_DISCREPANCY_NONE;
+      if(discrepancy == previous) {
+         return;
+      }
+      if(discrepancy == MPLS_ROUTE_DISCREPANCY_NONE) {
+         states.erase(it);
+      } else {
+         states[key] = state{discrepancy, now()};
+      }
+      reconciler->on_mpls_route_discrepancy(key, discrepancy);
+   }
+
+   /// Records that a route is no longer programmed.
+   void fec_unbind(mpls_route_key_t const & key) {
+      auto it = route_fecs.find(key);
+      if(it == route_fecs.end()) {
+         return;
+      }
+      auto routes = fec_routes.find(it->second);
+      if(routes != fec_routes.end()) {
+         routes->second.erase(key);
+         if(routes->second.empty()) {
+            fec_routes.erase(routes);
+         }
+      }
+      route_fecs.erase(it);
+   }
+
+   /// Records that a route is programmed, with its FEC if known.
+   void fec_bind(mpls_route_key_t const & key, mpls_fec_id_t const & fec) {
+      fec_unbind(key);
+      route_fecs[key] = fec;
+      if(fec.id()) {
+         fec_routes[fec].insert(key);
+      }
+   }
+
+   /// A route is programmed when it is recorded with its FEC.
+   bool is_programmed(mpls_route_key_t const & key) const {
+      return route_fecs.count(key) != 0;
+   }
+
+   void reconcile() {
+      // Record the routes in hardware anew, sorted by key.
+      route_fecs.clear();
+      fec_routes.clear();
+      for(auto iter = mgr()->mpls_route_status_iter(); iter; ++iter) {
+         fec_bind(*iter, mgr()->fec_id(*iter));
+      }
+      std::vector<mpls_route_key_t> config;
+      for(auto iter = mgr()->mpls_route_iter(); iter; ++iter) {
+         config.push_back(iter->key());
+      }
+      // The routes are normally iterated in key order already.
+      if(!std::is_sorted(config.begin(), config.end())) {
+         std::sort(config.begin(), config.end());
+      }
+
+      std::map<mpls_route_key_t, mpls_route_discrepancy_t> found;
+      auto c = config.begin();
+      auto s = route_fecs.begin();
+      while(c != config.end() || s != route_fecs.end()) {
+         bool configured = s == route_fecs.end() ||
+                           (c != config.end() && !(s->first < *c));
+         bool programmed = c == config.end() ||
+                           (s != route_fecs.end() && !(*c < s->first));
+         mpls_route_key_t const & key = configured ? *c : s->first;
+         mpls_route_discrepancy_t discrepancy = classify(key, configured,
+                                                         programmed);
+         if(discrepancy != MPLS_ROUTE_DISCREPANCY_NONE) {
+            found[key] = discrepancy;
+         }
+         if(configured) {
+            ++c;
+         }
+         if(programmed) {
+            ++s;
+         }
+      }
+
+      // Clear the discrepancies that are gone, then set the new ones.
+      std::vector<mpls_route_key_t> cleared;
+      for(auto const & route : states) {
+         if(!found.count(route.first)) {
+            cleared.push_back(route.first);
+         }
+      }
+      for(auto const & key : cleared) {
+         discrepancy_is(key, MPLS_ROUTE_DISCREPANCY_NONE);
+      }
+      for(auto const & route : found) {
+         discrepancy_is(route.first, route.second);
+      }
+   }
+
+   void route_check(mpls_route_key_t const & key) {
+      bool configured = mgr()->exists(key);
+      discrepancy_is(key, classify(key, configured, is_programmed(key)));
+   }
+
+   mpls_route_reconciler_t * reconciler;
+   std::map<mpls_route_key_t, state> states;
+   /**
+    * The routes in hardware with their FEC, from the last reconcile() and
+    * the route notifications since, and the routes of each FEC.
+    */
+   std::map<mpls_route_key_t, mpls_fec_id_t> route_fecs;
+   std::map<mpls_fec_id_t, std::set<mpls_route_key_t>> fec_routes;
+};
+
+mpls_route_reconciler_t::mpls_route_reconciler_t(mpls_route_mgr * mgr) :
+      mpls_route_handler(mgr),
+      reconciler_(new mpls_route_reconciler_internal(this)) {
+   watch_all_mpls_routes(true);
+}
+
+mpls_route_reconciler_t::~mpls_route_reconciler_t() {
+   delete reconciler_;
+}
+
+void
+mpls_route_reconciler_t::reconcile() {
+   reconciler_->reconcile();
+}
+
+void
+mpls_route_reconciler_t::route_check(mpls_route_key_t const & key) {
+   reconciler_->route_check(key);
+}
+
+void
+mpls_route_reconciler_t::clear() {
+   reconciler_->states.clear();
+}
+
+mpls_route_discrepancy_t
+mpls_route_reconciler_t::discrepancy(mpls_route_key_t const & key) const {
+   auto it = reconciler_->states.find(key);
+   return it != reconciler_->states.end() ? it->second.discrepancy
+                                          : MPLS_ROUTE_DISCREPANCY_NONE;
+}
+
+seconds_t
+mpls_route_reconciler_t::discrepancy_since(mpls_route_key_t const & key) const {
+   auto it = reconciler_->states.find(key);
+   return it != reconciler_->states.end() ? it->second.since : 0;
+}
+
+size_t
+mpls_route_reconciler_t::discrepancy_count() const {
+   return reconciler_->states.size();
+}
+
+size_t
+mpls_route_reconciler_t::discrepancy_count(
+      mpls_route_discrepancy_t discrepancy) const {
+   size_t count = 0;
+   for(auto const & route : reconciler_->states) {
+      count += route.second.discrepancy == discrepancy;
+   }
+   return count;
+}
+
+std::vector<mpls_route_key_t>
+mpls_route_reconciler_t::discrepancies(
+      mpls_route_discrepancy_t discrepancy) const {
+   std::vector<mpls_route_key_t> result;
+   for(auto const & route : reconciler_->states) {
+      if(route.second.discrepancy == discrepancy) {
+         result.push_back(route.first);
+      }
+   }
+   return result;
+}
+
+void
+mpls_route_reconciler_t::on_mpls_route_discrepancy(
+      mpls_route_key_t const & key, mpls_route_discrepancy_t discrepancy) {
+}
+
+void
+mpls_route_reconciler_t::on_mpls_route_set(mpls_route_key_t const & key,
+                                           mpls_fec_id_t fec) {
+   reconciler_->fec_bind(key, fec);
+   reconciler_->route_check(key);
+}
+
+void
+mpls_route_reconciler_t::on_mpls_route_del(mpls_route_key_t const & key) {
+   reconciler_->fec_unbind(key);
+   reconciler_->route_check(key);
+}
+
+void
+mpls_route_reconciler_t::on_mpls_fec_set(mpls_fec_id_t fec) {
+   // The vias of the FEC changed: compare the routes using it.
+   auto routes = reconciler_->fec_routes.find(fec);
+   if(routes == reconciler_->fec_routes.end()) {
+      return;
+   }
+   std::vector<mpls_route_key_t> keys(routes->second.begin(),
+                                      routes->second.end());
+   for(auto const & key : keys) {
+      reconciler_->route_check(key);
+   }
+}
+
+}  // namespace eos
@@ -1,14 +1,53 @@
 // Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
+#include <unordered_map>
+
 #include "eos/neighbor_table.h"
 #include "impl.h"
 
 namespace eos {
 
+struct neighbor_key_hash {
+   size_t operator()(neighbor_key_t const & key) const {
+      return key.hash();
+   }
+};
+
+typedef std::unordered_map<neighbor_key_t, neighbor_entry_t, neighbor_key_hash>
+   neighbor_entries_t;
+
 class neighbor_table_mgr_impl : public neighbor_table_mgr {
  public:
-   neighbor_table_mgr_impl() {
+   neighbor_table_mgr_impl() : resync_(false) {
+   }
+
+   void resync_init() {
+      resync_ = true;
+      resync_entries_.clear();
+   }
+
+   void resync_complete() {
+      if(!resync_) {
+         return;
+      }
+      resync_ = false;
+      neighbor_entries_t entries;
+      entries.swap(resync_entries_);
+      // Only push the differences with the configuration in place.
+      std::vector<neighbor_key_t> deleted;
+      for(auto const & entry : entries_) {
+         if(!entries.count(entry.first)) {
+            deleted.push_back(entry.first);
+         }
+      }
+      std::vector<neighbor_entry_t> updated;
+      updated.reserve(entries.size());
+      for(auto & entry : entries) {
+         updated.push_back(std::move(entry.second));
+      }
+      neighbor_entries_del(deleted);
+      neighbor_entries_set(updated);
    }
 
    neighbor_table_iter_t neighbor_table_iter() const {
@@ -27,29 +66,117 @@ class neighbor_table_mgr_impl : public neighbor_table_mgr {
    }
 
    virtual neighbor_entry_t neighbor_entry_status(neighbor_key_t const & key) const {
-      return neighbor_entry_t();
+      // Static entries are reported as resolved right away.
+      auto it = entries_.find(key);
+      return it != entries_.end() ? it->second : neighbor_entry_t();
+   }
+
+   virtual void neighbor_entry_set(neighbor_entry_t const & entry) {
+      neighbor_entries_set(std::vector<neighbor_entry_t>(1, entry));
    }
 
-   virtual void neighbor_entry_set(neighbor_entry_t const & entry) {}
-   virtual void neighbor_entry_del(neighbor_key_t const & key) {}
+   virtual void neighbor_entry_del(neighbor_key_t const & key) {
+      neighbor_entries_del(std::vector<neighbor_key_t>(1, key));
+   }
+
+   void neighbor_entries_set(std::vector<neighbor_entry_t> const & entries) {
+      if(resync_) {
+         for(auto const & entry : entries) {
+            resync_entries_[entry.neighbor_key()] = entry;
+         }
+         return;
+      }
+      std::vector<neighbor_entry_t const *> changed;
+      for(auto const & entry : entries) {
+         auto it = entries_.emplace(entry.neighbor_key(), entry);
+         if(it.second) {
+            changed.push_back(&entry);
+         } else if(it.first->second != entry) {
+            it.first->second = entry;
+            changed.push_back(&entry);
+         }
+      }
+      for(auto const * entry : changed) {
+         handler_foreach(entry->neighbor_key(),
+                         [entry](neighbor_table_handler * handler) {
+                            handler->on_neighbor_entry_set(*entry);
+                         });
+      }
+   }
+
+   void neighbor_entries_del(std::vector<neighbor_key_t> const & keys) {
+      neighbor_entries_t & entries = resync_ ? resync_entries_ : entries_;
+      std::vector<neighbor_key_t const *> deleted;
+      for(auto const & key : keys) {
+         if(entries.erase(key)) {
+            deleted.push_back(&key);
+         }
+      }
+      if(resync_) {
+         return;
+      }
+      for(auto const * key : deleted) {
+         handler_foreach(*key, [key](neighbor_table_handler * handler) {
+            handler->on_neighbor_entry_del(*key);
+         });
+      }
+   }
 
    virtual neighbor_entry_t neighbor_entry(
                                neighbor_key_t const & key) const {
-      return neighbor_entry_t();
+      neighbor_entries_t const & entries = resync_ ? resync_entries_ : entries_;
+      auto it = entries.find(key);
+      return it != entries.end() ? it->second : neighbor_entry_t();
    }
 
-
+ private:
+   neighbor_entries_t entries_;
+   bool resync_;
+   // The entries set since resync_init().
+   neighbor_entries_t resync_entries_;
 };
 
+// -- pimpl wrappers to the resync and batch entry functions
+
+void neighbor_table_mgr::resync_init() {
+   static_cast<neighbor_table_mgr_impl *>(this)->resync_init();
+}
+
+void neighbor_table_mgr::resync_complete() {
+   static_cast<neighbor_table_mgr_impl *>(this)->resync_complete();
+}
+
+void neighbor_table_mgr::neighbor_entries_set(
+      std::vector<neighbor_entry_t> const & entries) {
+   static_cast<neighbor_table_mgr_impl *>(this)->neighbor_entries_set(entries);
+}
+
+void neighbor_table_mgr::neighbor_entries_del(
+      std::vector<neighbor_key_t> const & keys) {
+   static_cast<neighbor_table_mgr_impl *>(this)->neighbor_entries_del(keys);
+}
+
+// -- end of wrappers
+
 DEFINE_STUB_MGR_CTOR(neighbor_table_mgr)
 
 neighbor_table_handler::neighbor_table_handler(neighbor_table_mgr *mgr) :
                               base_handler(mgr) {
 }
 void neighbor_table_handler::watch_all_neighbor_entries(bool interest) {
+   if(interest) {
+      mgr_->add_handler(this);
+   } else {
+      mgr_->remove_handler(this);
+   }
 }
 void neighbor_table_handler::watch_neighbor_entry(neighbor_key_t const & key,
                                                    bool interest) {
+   if(interest) {
+      mgr_->add_handler(key, this);
+   } else {
+      mgr_->remove_handler(key, this);
+   }
 }
 void neighbor_table_handler::on_neighbor_entry_del(neighbor_key_t const & key) {
 }
@@ -1,9 +1,17 @@
 // Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
+#include <map>
+#include <vector>
+
 #include "eos/class_map.h"
 #include "eos/exception.h"
+#include "eos/policy_map.h"
+#include "eos/timer.h"
+#include "eos/traffic_policy_counters.h"
+#include "eos/types/policy_map_impl.h"
 #include "impl.h"
+#include "intern.h"
 
 namespace std {
 
@@ -29,20 +37,28 @@ policy_map_handler::policy_map_handler(policy_map_mgr * mgr) :
 
 void
 policy_map_handler::watch_all_policy_maps(bool interest) {
-   // TODO: no op impl.
+   if(interest) {
+      mgr_->add_handler(this);
+   } else {
+      mgr_->remove_handler(this);
+   }
 }
 
 void
 policy_map_handler::watch_policy_map(policy_map_key_t const & key,
                                          bool interest) {
-   // TODO: no op impl.
+   if(interest) {
+      mgr_->add_handler(key, this);
+   } else {
+      mgr_->remove_handler(key, this);
+   }
 }
 
 void
 policy_map_handler::watch_policy_map(policy_map_key_t const & key,
                                      std::string const & name,
                                      bool interest) {
-   // TODO: no op impl.
+   watch_policy_map(key, interest);
 }
 
 void
@@ -66,6 +82,25 @@ policy_map_handler::on_traffic_policy_config_set( policy_map_key_t const & name
    // TODO: no op impl.
 }
 
+/// Shares the raw ACL rules of the policy map rules stored by the manager.
+class policy_map_rule_helper {
+ public:
+   struct raw_rule_equal {
+      bool operator()(acl_rule_ip_t const & a, acl_rule_ip_t const & b) const {
+         return policy_map_rule_impl_t::raw_rule_equal(a, b);
+      }
+   };
+   typedef intern_table<acl_rule_ip_t, raw_rule_equal> raw_rule_table;
+
+   /// Returns a copy of the rule whose raw rule is the interned instance.
+   static policy_map_rule_t raw_rule_intern(policy_map_rule_t const & rule,
+                                            raw_rule_table & raw_rules) {
+      policy_map_rule_t interned(rule);
+      interned.pimpl->raw_rule_ = raw_rules.intern(*rule.pimpl->raw_rule_);
+      return interned;
+   }
+};
+
 class policy_map_mgr_impl : public policy_map_mgr {
  public:
    policy_map_mgr_impl() {
@@ -78,7 +113,7 @@ class policy_map_mgr_impl : public policy_map_mgr {
    }
 
    bool exists(policy_map_key_t const & key) const {
-      return false;
+      return committed_.find(key) != committed_.end();
    }
 
    bool traffic_policy_exists(std::string const & key) const {
@@ -86,13 +121,52 @@ class policy_map_mgr_impl : public policy_map_mgr {
    }
 
    policy_map_t policy_map(policy_map_key_t const & key) const {
-      return policy_map_t();
+      auto it = committed_.find(key);
+      return it == committed_.end() ? policy_map_t() : it->second;
    }
 
    void policy_map_is(policy_map_t const & policy_map) {
+      staged_.erase(policy_map.key());
+      if(push(policy_map)) {
+         sync_notify(std::vector<policy_map_key_t>(1, policy_map.key()));
+      }
    }
 
    void policy_map_del(policy_map_key_t const & key) {
+      committed_.erase(key);
+      staged_.erase(key);
+      hw_statuses_.erase(key);
+   }
+
+   void policy_map_rule_set(policy_map_key_t const & key, uint32_t seq,
+                            policy_map_rule_t const & rule) {
+      staged(key).rule_set(seq, rule);
+   }
+
+   void policy_map_rule_del(policy_map_key_t const & key, uint32_t seq) {
+      staged(key).rule_del(seq);
+   }
+
+   void policy_map_commit() {
+      std::vector<policy_map_key_t> changed;
+      for(auto const & entry : staged_) {
+         if(push(entry.second)) {
+            changed.push_back(entry.first);
+         }
+      }
+      staged_.clear();
+      sync_notify(changed);
+   }
+
+   uint32_t policy_map_pending_rule_count(policy_map_key_t const & key) const {
+      auto it = staged_.find(key);
+      if(it == staged_.end()) {
+         return 0;
+      }
+      auto committed = committed_.find(key);
+      return rules_diff(committed == committed_.end() ?
+                           policy_map_t(key) : committed->second,
+                        it->second).size();
    }
 
    traffic_policy_t traffic_policy(std::string const & tpName) const {
@@ -115,25 +189,186 @@ class policy_map_mgr_impl : public policy_map_mgr {
       return *nop;
    }
 
-   void policy_map_apply(policy_map_key_t const &, intf_id_t,
-                         acl_direction_t, bool apply) {
+   void policy_map_apply(policy_map_key_t const & key, intf_id_t intf,
+                         acl_direction_t direction, bool apply) {
+      policy_map_hw_status_key_t status_key(intf, direction);
+      // Only one policy map of a feature can be applied on an interface, so
+      // unapplying removes whichever one is, and applying replaces it.
+      for(auto & entry : hw_statuses_) {
+         if(entry.first.feature() == key.feature()) {
+            entry.second.intf_statuse_del(status_key);
+         }
+      }
+      if(apply) {
+         hw_statuses_[key].intf_statuse_set(status_key, POLICY_STATUS_SUCCESS);
+         sync_notify(std::vector<policy_map_key_t>(1, key));
+      }
    }
 
    void traffic_policy_apply(std::string const &, intf_id_t,
                              traffic_policy_direction_t, bool apply) {
    }
 
+   traffic_policy_counter_t traffic_policy_counter(
+         std::string const & tpName) const {
+      return traffic_policy_counter_t(tpName);
+   }
+
+   void traffic_policy_counters(
+         traffic_policy_counter_snapshot_t & snapshot) const {
+      // Traffic policies count nothing in the stub, as traffic_policy_counter()
+      // shows: the snapshot has no rows.
+      snapshot.clear();
+      snapshot.timestamp_is(now());
+   }
+
    policy_map_hw_status_iter_t policy_map_hw_status_iter(policy_feature_t) const {
       policy_map_hw_status_iter_t *nop = 0;
       return *nop;
    }
    
    policy_map_hw_statuses_t hw_status(policy_map_key_t const &key) const {
-      return policy_map_hw_statuses_t();
+      auto it = hw_statuses_.find(key);
+      return it == hw_statuses_.end() ? policy_map_hw_statuses_t() : it->second;
    }
 
+ private:
+   /// Returns the working copy of a policy map to stage rule changes on.
+   policy_map_t & staged(policy_map_key_t const & key) {
+      auto it = staged_.find(key);
+      if(it == staged_.end()) {
+         auto committed = committed_.find(key);
+         it = staged_.emplace(key, committed == committed_.end() ?
+                                      policy_map_t(key) :
+                                      committed->second).first;
+      }
+      return it->second;
+   }
+
+   /// Returns the sequence numbers of the rules that differ between two maps.
+   static std::vector<uint32_t> rules_diff(policy_map_t const & from,
+                                           policy_map_t const & to) {
+      std::vector<uint32_t> diff;
+      auto const & old_rules = from.rules();
+      auto const & new_rules = to.rules();
+      auto o = old_rules.begin();
+      auto n = new_rules.begin();
+      while(o != old_rules.end() || n != new_rules.end()) {
+         if(n == new_rules.end() || (o != old_rules.end() && o->first < n->first)) {
+            diff.push_back((o++)->first);
+         } else if(o == old_rules.end() || n->first < o->first) {
+            diff.push_back((n++)->first);
+         } else {
+            if(o->second != n->second) {
+               diff.push_back(o->first);
+            }
+            ++o;
+            ++n;
+         }
+      }
+      return diff;
+   }
+
+   /**
+    * Pushes the rules of a policy map that differ from its committed
+    * version. Returns false if there was nothing to push.
+    */
+   bool push(policy_map_t const & policy_map) {
+      auto it = committed_.find(policy_map.key());
+      if(it == committed_.end()) {
+         it = committed_.emplace(policy_map.key(), policy_map).first;
+         for(auto const & rule : policy_map.rules()) {
+            it->second.rule_set(rule.first, policy_map_rule_helper::raw_rule_intern(
+                                   rule.second, raw_rules_));
+         }
+         return true;
+      }
+      std::vector<uint32_t> diff = rules_diff(it->second, policy_map);
+      if(diff.empty()) {
+         return false;
+      }
+      auto const & rules = policy_map.rules();
+      for(uint32_t seq : diff) {
+         auto rule = rules.find(seq);
+         if(rule == rules.end()) {
+            it->second.rule_del(seq);
+         } else {
+            it->second.rule_set(seq, policy_map_rule_helper::raw_rule_intern(
+                                   rule->second, raw_rules_));
+         }
+      }
+      return true;
+   }
+
+   /**
+    * Marks the given policy maps as programmed on all the interfaces they
+    * are applied on, then notifies handlers once per policy map.
+    */
+   void sync_notify(std::vector<policy_map_key_t> const & keys) {
+      for(auto const & key : keys) {
+         auto it = hw_statuses_.find(key);
+         if(it == hw_statuses_.end()) {
+            continue;
+         }
+         std::map<policy_map_hw_status_key_t, policy_map_status_t> statuses;
+         for(auto const & status : it->second.intf_statuses()) {
+            statuses.emplace_hint(statuses.end(), status.first,
+                                  POLICY_STATUS_SUCCESS);
+         }
+         it->second.intf_statuses_is(std::move(statuses));
+      }
+      for(auto const & key : keys) {
+         handler_foreach(key, [&key](policy_map_handler * handler) {
+            handler->on_policy_map_sync(key);
+         });
+      }
+   }
+
+   std::map<policy_map_key_t, policy_map_t> committed_;
+   // Working copies of the policy maps with staged rule changes.
+   std::map<policy_map_key_t, policy_map_t> staged_;
+   std::map<policy_map_key_t, policy_map_hw_statuses_t> hw_statuses_;
+   // The raw rules of the committed policy maps, each stored once.
+   policy_map_rule_helper::raw_rule_table raw_rules_;
 };
 
+// -- pimpl wrappers to the rule-level policy map and counter functions
+
+void policy_map_mgr::policy_map_rule_set(policy_map_key_t const & key,
+                                         uint32_t seq,
+                                         policy_map_rule_t const & rule) {
+   static_cast<policy_map_mgr_impl *>(this)->policy_map_rule_set(key, seq, rule);
+}
+
+void policy_map_mgr::policy_map_rule_del(policy_map_key_t const & key,
+                                         uint32_t seq) {
+   static_cast<policy_map_mgr_impl *>(this)->policy_map_rule_del(key, seq);
+}
+
+void policy_map_mgr::policy_map_commit() {
+   static_cast<policy_map_mgr_impl *>(this)->policy_map_commit();
+}
+
+uint32_t policy_map_mgr::policy_map_pending_rule_count(
+      policy_map_key_t const & key) const {
+   return static_cast<policy_map_mgr_impl const *>(this)->
+      policy_map_pending_rule_count(key);
+}
+
+traffic_policy_counter_t policy_map_mgr::traffic_policy_counter(
+      std::string const & tpName) const {
+   return static_cast<policy_map_mgr_impl const *>(this)->
+      traffic_policy_counter(tpName);
+}
+
+void policy_map_mgr::traffic_policy_counters(
+      traffic_policy_counter_snapshot_t & snapshot) const {
+   static_cast<policy_map_mgr_impl const *>(this)->traffic_policy_counters(
+      snapshot);
+}
+
+// -- end of wrappers
+
 DEFINE_STUB_MGR_CTOR(policy_map_mgr)
 
 }
@@ -4,10 +4,25 @@
 #include "eos/policy_map.h"
 #include <eos/class_map.h>
 #include <eos/exception.h>
+#include <eos/types/policy_map_impl.h>
 
 namespace eos {
 
 static std::string const RULE_CONFIG_ERROR_ = \
    "Policy maps have either one MPLS match rule or a collection of other rules";
 
+std::shared_ptr<acl_rule_ip_t const> const &
+policy_map_rule_impl_t::raw_rule_default() {
+   // Never destroyed, so that rules can outlive static destruction.
+   static auto * raw_rule =
+      new std::shared_ptr<acl_rule_ip_t const>(new acl_rule_ip_t());
+   return *raw_rule;
+}
+
+bool
+policy_map_rule_impl_t::raw_rule_equal(acl_rule_ip_t const & a,
+                                       acl_rule_ip_t const & b) {
+   return acl_rule_ip_equal(a, b);
+}
+
 }
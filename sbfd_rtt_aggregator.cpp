@@ -0,0 +1,358 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "eos/sbfd_rtt_aggregator.h"
+#include "eos/timer.h"
+
+namespace eos {
+
+namespace {
+
+/**
+ * Values under 64 have a bucket each. Above, each power of two is split
+ * into 32 buckets: a value is bucketed by its 6 most significant bits.
+ */
+static int const SUB_BUCKET_BITS = 6;
+static int const SUB_BUCKET_HALF = 1 << (SUB_BUCKET_BITS - 1);
+static int const BUCKETS = (32 - SUB_BUCKET_BITS + 2) * SUB_BUCKET_HALF;
+
+int bucket_shift(uint32_t value) {
+   int msb = value ? 31 - __builtin_clz(value) : 0;
+   return std::max(msb - (SUB_BUCKET_BITS - 1), 0);
+}
+
+int bucket_index(uint32_t value) {
+   int shift = bucket_shift(value);
+   return shift * SUB_BUCKET_HALF + (value >> shift);
+}
+
+/// Returns the highest value of a bucket.
+uint32_t bucket_value(int index) {
+   int shift = std::max(index / SUB_BUCKET_HALF - 1, 0);
+   uint64_t first = uint64_t(index - shift * SUB_BUCKET_HALF) << shift;
+   return first + (uint64_t(1) << shift) - 1;
+}
+
+struct sbfd_key_hash {
+   size_t operator()(sbfd_echo_session_key_t const & key) const {
+      return key.hash();
+   }
+};
+
+/// The RTTs of a session recorded during one window.
+struct rtt_window {
+   rtt_window() : counts(BUCKETS), samples(0), min(0), max(0), deviation(0),
+                  deviations(0) {
+   }
+
+   void clear() {
+      std::fill(counts.begin(), counts.end(), 0);
+      samples = 0;
+      min = max = 0;
+      deviation = 0;
+      deviations = 0;
+   }
+
+   void extremes_add(uint32_t low, uint32_t high) {
+      min = samples ? std::min(min, low) : low;
+      max = samples ? std::max(max, high) : high;
+   }
+
+   std::vector<uint32_t> counts;
+   uint64_t samples;
+   uint32_t min;
+   uint32_t max;
+   // The sum and number of the deviations between consecutive samples.
+   double deviation;
+   uint64_t deviations;
+};
+
+/**
+ * The RTTs of a session, over the current and the previous window: the
+ * statistics cover between one and two windows of samples, and the
+ * samples older than that are forgotten.
+ */
+struct rtt_history {
+   rtt_history() : window_start(0), last(0), exceeded(false) {
+   }
+
+   /**
+    * Starts a new window if the current one is over. A window of 0 never
+    * ends.
+    */
+   void rotate(seconds_t now, seconds_t window) {
+      if(!window || now < window_start + window) {
+         return;
+      }
+      if(now < window_start + 2 * window) {
+         std::swap(current, previous);
+         window_start += window;
+      } else {
+         // No sample was recorded in the last window.
+         previous.clear();
+         window_start = now;
+      }
+      current.clear();
+   }
+
+   void add(uint32_t rtt, uint32_t min, uint32_t max) {
+      if(current.samples + previous.samples) {
+         current.deviation += std::fabs(double(rtt) - double(last));
+         ++current.deviations;
+      }
+      current.extremes_add(min, max);
+      ++current.counts[bucket_index(rtt)];
+      ++current.samples;
+      last = rtt;
+   }
+
+   uint64_t samples() const {
+      return current.samples + previous.samples;
+   }
+
+   /**
+    * Returns the RTTs at some percentiles, in increasing order, in a single
+    * pass over the buckets of both windows.
+    */
+   void percentiles(double const * percentiles, uint32_t * values,
+                    size_t count) const {
+      uint64_t total = samples();
+      uint32_t low = min();
+      uint32_t high = max();
+      uint64_t seen = 0;
+      int index = 0;
+      for(size_t i = 0; i < count; ++i) {
+         double rank = std::ceil(percentiles[i] / 100 * total);
+         uint64_t target = std::max<uint64_t>(std::min<double>(rank, total), 1);
+         while(seen + current.counts[index] + previous.counts[index] < target) {
+            seen += current.counts[index] + previous.counts[index];
+            ++index;
+         }
+         // Report the exact extremes rather than their bucket.
+         values[i] = std::min(std::max(bucket_value(index), low), high);
+      }
+   }
+
+   uint32_t min() const {
+      if(!previous.samples) {
+         return current.min;
+      }
+      return current.samples ? std::min(current.min, previous.min)
+                             : previous.min;
+   }
+
+   uint32_t max() const {
+      return std::max(current.max, previous.max);
+   }
+
+   sbfd_rtt_summary_t summary() const {
+      uint64_t total = samples();
+      if(!total) {
+         return sbfd_rtt_summary_t();
+      }
+      static double const quantiles[] = {50, 99, 99.9};
+      uint32_t values[3];
+      percentiles(quantiles, values, 3);
+      uint64_t deviations = current.deviations + previous.deviations;
+      double jitter = deviations ? (current.deviation + previous.deviation) /
+                                   deviations : 0;
+      return sbfd_rtt_summary_t(total, min(), max(), values[0], values[1],
+                                values[2], uint32_t(jitter + 0.5));
+   }
+
+   rtt_window current;
+   rtt_window previous;
+   seconds_t window_start;
+   uint32_t last;
+   // Whether the session was last reported over the thresholds.
+   bool exceeded;
+};
+
+}  // namespace
+
+class sbfd_rtt_aggregator_internal {
+ public:
+   sbfd_rtt_aggregator_internal() : p99_threshold(0), jitter_threshold(0),
+                                    window(60) {
+   }
+
+   /// Returns a session with its windows up to date, or NULL if unknown.
+   rtt_history * lookup(sbfd_echo_session_key_t const & key) {
+      auto it = sessions.find(key);
+      if(it == sessions.end()) {
+         return NULL;
+      }
+      it->second.rotate(now(), window);
+      return &it->second;
+   }
+
+   /**
+    * Records a sample: the RTT with the extremes measured with it, which are
+    * the RTT itself for a single measurement.
+    */
+   rtt_history & sample_add(sbfd_echo_session_key_t const & key, uint32_t rtt,
+                            uint32_t min, uint32_t max) {
+      seconds_t time = now();
+      auto result = sessions.emplace(key, rtt_history());
+      rtt_history & session = result.first->second;
+      if(result.second) {
+         session.window_start = time;
+      } else {
+         session.rotate(time, window);
+      }
+      session.add(rtt, min, max);
+      return session;
+   }
+
+   /**
+    * Updates whether a session is over the thresholds, returning true if
+    * that changed.
+    */
+   bool threshold_update(rtt_history & session, sbfd_rtt_summary_t & summary) {
+      if(!p99_threshold && !jitter_threshold && !session.exceeded) {
+         return false;
+      }
+      summary = session.summary();
+      bool exceeded = (p99_threshold && summary.p99_rtt() > p99_threshold) ||
+                      (jitter_threshold && summary.jitter() > jitter_threshold);
+      if(exceeded == session.exceeded) {
+         return false;
+      }
+      session.exceeded = exceeded;
+      return true;
+   }
+
+   std::unordered_map<sbfd_echo_session_key_t, rtt_history, sbfd_key_hash>
+      sessions;
+   uint32_t p99_threshold;
+   uint32_t jitter_threshold;
+   seconds_t window;
+};
+
+sbfd_rtt_aggregator_t::sbfd_rtt_aggregator_t(bfd_session_mgr * mgr) :
+      bfd_session_handler(mgr), aggregator_(new sbfd_rtt_aggregator_internal()) {
+   watch_all_sbfd_echo_sessions(true);
+}
+
+sbfd_rtt_aggregator_t::~sbfd_rtt_aggregator_t() {
+   delete aggregator_;
+}
+
+void
+sbfd_rtt_aggregator_t::rtt_add(sbfd_echo_session_key_t const & key,
+                               uint32_t rtt) {
+   sample_add(key, rtt, rtt, rtt);
+}
+
+void
+sbfd_rtt_aggregator_t::sample_add(sbfd_echo_session_key_t const & key,
+                                  uint32_t rtt, uint32_t min, uint32_t max) {
+   rtt_history & session = aggregator_->sample_add(key, rtt, min, max);
+   sbfd_rtt_summary_t summary;
+   if(aggregator_->threshold_update(session, summary)) {
+      on_sbfd_rtt_threshold(key, summary, session.exceeded);
+   }
+}
+
+sbfd_rtt_summary_t
+sbfd_rtt_aggregator_t::rtt_summary(sbfd_echo_session_key_t const & key) const {
+   rtt_history const * session = aggregator_->lookup(key);
+   return session ? session->summary() : sbfd_rtt_summary_t();
+}
+
+std::vector<std::pair<sbfd_echo_session_key_t, sbfd_rtt_summary_t>>
+sbfd_rtt_aggregator_t::rtt_summaries() const {
+   std::vector<std::pair<sbfd_echo_session_key_t, sbfd_rtt_summary_t>> result;
+   result.reserve(aggregator_->sessions.size());
+   seconds_t time = now();
+   for(auto & session : aggregator_->sessions) {
+      session.second.rotate(time, aggregator_->window);
+      if(session.second.samples()) {
+         result.push_back(std::make_pair(session.first,
+                                         session.second.summary()));
+      }
+   }
+   return result;
+}
+
+uint32_t
+sbfd_rtt_aggregator_t::rtt_percentile(sbfd_echo_session_key_t const & key,
+                                      double percentile) const {
+   rtt_history const * session = aggregator_->lookup(key);
+   if(!session || !session->samples()) {
+      return 0;
+   }
+   percentile = std::min(std::max(percentile, 0.0), 100.0);
+   uint32_t value;
+   session->percentiles(&percentile, &value, 1);
+   return value;
+}
+
+void
+sbfd_rtt_aggregator_t::rtt_threshold_is(uint32_t p99_rtt, uint32_t jitter) {
+   aggregator_->p99_threshold = p99_rtt;
+   aggregator_->jitter_threshold = jitter;
+   seconds_t time = now();
+   for(auto & session : aggregator_->sessions) {
+      session.second.rotate(time, aggregator_->window);
+      sbfd_rtt_summary_t summary;
+      if(session.second.samples() &&
+         aggregator_->threshold_update(session.second, summary)) {
+         on_sbfd_rtt_threshold(session.first, summary, session.second.exceeded);
+      }
+   }
+}
+
+void
+sbfd_rtt_aggregator_t::rtt_window_is(seconds_t window) {
+   aggregator_->window = std::max(window, 0.0);
+}
+
+seconds_t
+sbfd_rtt_aggregator_t::rtt_window() const {
+   return aggregator_->window;
+}
+
+void
+sbfd_rtt_aggregator_t::rtt_reset(sbfd_echo_session_key_t const & key) {
+   aggregator_->sessions.erase(key);
+}
+
+void
+sbfd_rtt_aggregator_t::clear() {
+   aggregator_->sessions.clear();
+}
+
+void
+sbfd_rtt_aggregator_t::on_sbfd_rtt_threshold(sbfd_echo_session_key_t const & key,
+                                             sbfd_rtt_summary_t const & summary,
+                                             bool exceeded) {
+}
+
+void
+sbfd_rtt_aggregator_t::on_sbfd_echo_session_rtt(
+      sbfd_echo_session_key_t const & key,
+      sbfd_echo_session_rtt_stats_t const & stats) {
+   if(!stats.snapshot_avg_rtt()) {
+      // No probe was answered since the previous report.
+      return;
+   }
+   // Keep the extremes measured between reports, which the average hides.
+   uint32_t rtt = stats.snapshot_avg_rtt();
+   uint32_t min = stats.snapshot_min_rtt() ? std::min(stats.snapshot_min_rtt(), rtt)
+                                           : rtt;
+   uint32_t max = std::max(stats.snapshot_max_rtt(), rtt);
+   sample_add(key, rtt, min, max);
+}
+
+void
+sbfd_rtt_aggregator_t::on_sbfd_echo_session_del(
+      sbfd_echo_session_key_t const & key) {
+   aggregator_->sessions.erase(key);
+}
+
+}  // namespace eos
@@ -0,0 +1,265 @@
+// Copyright (c) 2026 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <unordered_map>
+
+#include "eos/traffic_policy_counters.h"
+
+namespace eos {
+
+namespace {
+
+/**
+ * Computes the increase and rate of one counter column. Kept free of
+ * branches and aliasing so the compiler can vectorize it.
+ */
+void column_delta(uint64_t const * __restrict current,
+                  uint64_t const * __restrict previous, size_t count,
+                  double scale, uint64_t * __restrict delta,
+                  double * __restrict rate) {
+   for(size_t i = 0; i < count; ++i) {
+      // A counter that went backwards was cleared: count from zero.
+      uint64_t d = current[i] >= previous[i] ? current[i] - previous[i] :
+                                               current[i];
+      delta[i] = d;
+      rate[i] = double(d) * scale;
+   }
+}
+
+/// The key a row is matched on between two snapshots.
+std::string row_key(std::string const & policy, std::string const & name,
+                    bool class_counter) {
+   std::string key;
+   key.reserve(policy.size() + name.size() + 2);
+   key += policy;
+   key += '\0';
+   key += name;
+   key += class_counter ? '\1' : '\0';
+   return key;
+}
+
+}  // namespace
+
+traffic_policy_counter_snapshot_t::traffic_policy_counter_snapshot_t() :
+      timestamp_(0) {
+}
+
+void
+traffic_policy_counter_snapshot_t::clear() {
+   timestamp_ = 0;
+   policies_.clear();
+   policy_index_.clear();
+   counter_names_.clear();
+   class_counter_.clear();
+   pkt_hits_.clear();
+   byte_hits_.clear();
+   pkt_drops_.clear();
+   byte_drops_.clear();
+}
+
+void
+traffic_policy_counter_snapshot_t::counter_add(
+      traffic_policy_counter_t const & counter) {
+   uint32_t policy = policies_.size();
+   policies_.push_back(counter.key());
+   for(auto const & entry : counter.named_counter_data()) {
+      row_add(policy, entry.first, false, entry.second);
+   }
+   for(auto const & entry : counter.class_counter_data()) {
+      row_add(policy, entry.first, true, entry.second);
+   }
+}
+
+void
+traffic_policy_counter_snapshot_t::row_add(
+      uint32_t policy, std::string const & name, bool class_counter,
+      traffic_policy_counter_data_t const & data) {
+   policy_index_.push_back(policy);
+   counter_names_.push_back(name);
+   class_counter_.push_back(class_counter);
+   pkt_hits_.push_back(data.pktHits());
+   byte_hits_.push_back(data.byteHits());
+   pkt_drops_.push_back(data.pktDrops());
+   byte_drops_.push_back(data.byteDrops());
+}
+
+seconds_t
+traffic_policy_counter_snapshot_t::timestamp() const {
+   return timestamp_;
+}
+
+void
+traffic_policy_counter_snapshot_t::timestamp_is(seconds_t timestamp) {
+   timestamp_ = timestamp;
+}
+
+size_t
+traffic_policy_counter_snapshot_t::size() const {
+   return policy_index_.size();
+}
+
+std::string const &
+traffic_policy_counter_snapshot_t::policy(size_t row) const {
+   return policies_[policy_index_[row]];
+}
+
+std::string const &
+traffic_policy_counter_snapshot_t::counter_name(size_t row) const {
+   return counter_names_[row];
+}
+
+bool
+traffic_policy_counter_snapshot_t::class_counter(size_t row) const {
+   return class_counter_[row];
+}
+
+traffic_policy_counter_data_t
+traffic_policy_counter_snapshot_t::counter_data(size_t row) const {
+   return traffic_policy_counter_data_t(pkt_hits_[row], byte_hits_[row],
+                                        pkt_drops_[row], byte_drops_[row]);
+}
+
+uint64_t const *
+traffic_policy_counter_snapshot_t::pkt_hits() const {
+   return pkt_hits_.data();
+}
+
+uint64_t const *
+traffic_policy_counter_snapshot_t::byte_hits() const {
+   return byte_hits_.data();
+}
+
+uint64_t const *
+traffic_policy_counter_snapshot_t::pkt_drops() const {
+   return pkt_drops_.data();
+}
+
+uint64_t const *
+traffic_policy_counter_snapshot_t::byte_drops() const {
+   return byte_drops_.data();
+}
+
+bool
+traffic_policy_counter_snapshot_t::same_rows(
+      traffic_policy_counter_snapshot_t const & other) const {
+   if(size() != other.size() || policies_ != other.policies_ ||
+      policy_index_ != other.policy_index_ ||
+      class_counter_ != other.class_counter_) {
+      return false;
+   }
+   return counter_names_ == other.counter_names_;
+}
+
+void
+traffic_policy_counter_snapshot_t::delta(
+      traffic_policy_counter_snapshot_t const & previous,
+      traffic_policy_counter_delta_t & delta) const {
+   size_t count = size();
+   delta.interval_ = timestamp_ - previous.timestamp_;
+   double scale = delta.interval_ > 0 ? 1.0 / delta.interval_ : 0.0;
+
+   uint64_t const * prev_pkt_hits = previous.pkt_hits_.data();
+   uint64_t const * prev_byte_hits = previous.byte_hits_.data();
+   uint64_t const * prev_pkt_drops = previous.pkt_drops_.data();
+   uint64_t const * prev_byte_drops = previous.byte_drops_.data();
+   // When the set of policies and counters changed between the snapshots,
+   // line the previous values up with the current rows first.
+   std::vector<uint64_t> aligned;
+   if(!same_rows(previous)) {
+      std::unordered_map<std::string, size_t> rows;
+      rows.reserve(previous.size());
+      for(size_t row = 0; row < previous.size(); ++row) {
+         rows.emplace(row_key(previous.policy(row), previous.counter_names_[row],
+                              previous.class_counter_[row]),
+                      row);
+      }
+      aligned.assign(4 * count, 0);
+      for(size_t row = 0; row < count; ++row) {
+         auto it = rows.find(row_key(policy(row), counter_names_[row],
+                                     class_counter_[row]));
+         if(it != rows.end()) {
+            aligned[row] = previous.pkt_hits_[it->second];
+            aligned[count + row] = previous.byte_hits_[it->second];
+            aligned[2 * count + row] = previous.pkt_drops_[it->second];
+            aligned[3 * count + row] = previous.byte_drops_[it->second];
+         }
+      }
+      prev_pkt_hits = aligned.data();
+      prev_byte_hits = aligned.data() + count;
+      prev_pkt_drops = aligned.data() + 2 * count;
+      prev_byte_drops = aligned.data() + 3 * count;
+   }
+
+   delta.pkt_hits_.resize(count);
+   delta.byte_hits_.resize(count);
+   delta.pkt_drops_.resize(count);
+   delta.byte_drops_.resize(count);
+   delta.pkt_hit_rates_.resize(count);
+   delta.byte_hit_rates_.resize(count);
+   delta.pkt_drop_rates_.resize(count);
+   delta.byte_drop_rates_.resize(count);
+   column_delta(pkt_hits_.data(), prev_pkt_hits, count, scale,
+                delta.pkt_hits_.data(), delta.pkt_hit_rates_.data());
+   column_delta(byte_hits_.data(), prev_byte_hits, count, scale,
+                delta.byte_hits_.data(), delta.byte_hit_rates_.data());
+   column_delta(pkt_drops_.data(), prev_pkt_drops, count, scale,
+                delta.pkt_drops_.data(), delta.pkt_drop_rates_.data());
+   column_delta(byte_drops_.data(), prev_byte_drops, count, scale,
+                delta.byte_drops_.data(), delta.byte_drop_rates_.data());
+}
+
+traffic_policy_counter_delta_t::traffic_policy_counter_delta_t() :
+      interval_(0) {
+}
+
+size_t
+traffic_policy_counter_delta_t::size() const {
+   return pkt_hits_.size();
+}
+
+seconds_t
+traffic_policy_counter_delta_t::interval() const {
+   return interval_;
+}
+
+uint64_t const *
+traffic_policy_counter_delta_t::pkt_hits() const {
+   return pkt_hits_.data();
+}
+
+uint64_t const *
+traffic_policy_counter_delta_t::byte_hits() const {
+   return byte_hits_.data();
+}
+
+uint64_t const *
+traffic_policy_counter_delta_t::pkt_drops() const {
+   return pkt_drops_.data();
+}
+
+uint64_t const *
+traffic_policy_counter_delta_t::byte_drops() const {
+   return byte_drops_.data();
+}
+
+double const *
+traffic_policy_counter_delta_t::pkt_hit_rates() const {
+   return pkt_hit_rates_.data();
+}
+
+double const *
+traffic_policy_counter_delta_t::byte_hit_rates() const {
+   return byte_hit_rates_.data();
+}
+
+double const *
+traffic_policy_counter_delta_t::pkt_drop_rates() const {
+   return pkt_drop_rates_.data();
+}
+
+double const *
+traffic_policy_counter_delta_t::byte_drop_rates() const {
+   return byte_drop_rates_.data();
+}
+
+}  // namespace eos